@@ -0,0 +1,72 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_MAPPEDFILE_HPP
+#define CORE_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Core {
+
+/// \brief Read-only memory mapping of a whole file.
+/// The pages are loaded by the operating system as they are touched, nothing is
+/// copied. Where mmap is not available, the file is read into a buffer instead.
+/// The mapping is released when the object is destroyed.
+class MappedFile {
+private:
+    /// \brief First byte of the content, nullptr if the file is empty or could not be read.
+    const char* _data = nullptr;
+
+    /// \brief Size of the file in bytes.
+    std::size_t _size = 0;
+
+    /// \brief Whether _data is mapped, otherwise it is allocated by new[] (or nullptr).
+    bool _mapped = false;
+
+    /// \brief Whether the file could be read.
+    bool _valid = false;
+
+    /// \brief Release the mapping or the buffer.
+    void release();
+
+public:
+    /// \brief Map the file at \param path.
+    /// Afterwards the validity flag is set accordingly, empty files are valid.
+    explicit MappedFile(const std::string& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    ~MappedFile() {
+        release();
+    }
+
+    /// \brief Validity check. \returns true if the file could be opened and mapped.
+    bool valid() const {
+        return _valid;
+    }
+
+    /// \brief Validity check for convenience.
+    explicit operator bool() const {
+        return valid();
+    }
+
+    /// \brief The content of the file, valid as long as the mapping is.
+    std::string_view view() const {
+        return _data ? std::string_view(_data, _size) : std::string_view();
+    }
+
+    std::size_t size() const {
+        return _size;
+    }
+};
+
+}
+
+#endif //CORE_MAPPEDFILE_HPP
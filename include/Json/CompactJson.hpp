@@ -0,0 +1,246 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_COMPACTJSON_HPP
+#define CORE_COMPACTJSON_HPP
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Json/Json.hpp>
+
+namespace Core {
+
+/// \brief Read-only JSON document stored in two arenas.
+/// Every value is a node of 16 bytes in a single node array, the children of
+/// an object or array are stored next to each other (objects as key, value
+/// pairs), and the text of every string and key lives in a single byte arena.
+/// A document is therefore two allocations, destroying it releases both at once.
+class CompactJson {
+public:
+    /// \brief Type of a value.
+    enum class Type : std::uint8_t {
+        Null,
+        Bool,
+        Integer,
+        Double,
+        String,
+        Array,
+        Object
+    };
+
+private:
+    /// \brief A value.
+    struct Node {
+        Type type;
+
+        /// \brief Length of strings, number of elements of arrays, number of members of objects.
+        std::uint32_t size;
+
+        union {
+            bool boolean;
+            std::int64_t integer;
+            double number;
+            /// \brief Offset of strings in the byte arena, index of the first child of arrays and objects.
+            std::uint64_t offset;
+        };
+    };
+
+    /// \brief Every value of the document, the root is the last one.
+    std::vector<Node> _nodes;
+
+    /// \brief Text of the strings and keys, escape sequences decoded.
+    std::string _strings;
+
+    /// \brief Whether the text is a valid document.
+    bool _valid = false;
+
+    /// \brief Parse the value at the cursor onto \param stack. Internal use only.
+    bool parse_value(JsonCursor& cursor, std::vector<Node>& stack, std::size_t depth);
+
+    /// \brief Parse the object or array at the cursor onto \param stack. Internal use only.
+    bool parse_container(JsonCursor& cursor, std::vector<Node>& stack, std::size_t depth);
+
+    /// \brief Node of a string decoded into the byte arena.
+    Node make_string(std::string_view raw);
+
+public:
+    /// \brief Lightweight handle of a value in the document.
+    /// Valid as long as the document is.
+    class Element {
+    private:
+        friend class CompactJson;
+
+        const CompactJson* _document;
+        const Node* _node;
+
+        Element(const CompactJson* document, const Node* node) : _document(document), _node(node) {}
+
+        /// \brief Check if \param value is in the range of \tparam T.
+        template<class T>
+        static bool fits(std::int64_t value) {
+            if constexpr (std::is_signed_v<T>)
+                return value >= std::numeric_limits<T>::min() && value <= std::numeric_limits<T>::max();
+            else
+                return value >= 0 && static_cast<std::uint64_t>(value) <= std::numeric_limits<T>::max();
+        }
+
+        /// \brief The i-th child node of an array or object.
+        const Node* child(std::size_t index) const {
+            return &_document->_nodes[_node->offset + index];
+        }
+
+    public:
+        /// \brief Type of the value.
+        Type type() const {
+            return _node->type;
+        }
+
+        /// \brief Type checks.
+        bool is_null() const {
+            return type() == Type::Null;
+        }
+
+        bool is_bool() const {
+            return type() == Type::Bool;
+        }
+
+        bool is_number() const {
+            return type() == Type::Integer || type() == Type::Double;
+        }
+
+        bool is_string() const {
+            return type() == Type::String;
+        }
+
+        bool is_array() const {
+            return type() == Type::Array;
+        }
+
+        bool is_object() const {
+            return type() == Type::Object;
+        }
+
+        /// \brief Number of members of objects and elements of arrays, 0 otherwise.
+        /// Duplicated keys are counted individually.
+        std::size_t size() const {
+            return is_array() || is_object() ? _node->size : 0;
+        }
+
+        /// \brief Find the member \param key (the last one if the key is duplicated).
+        /// \returns std::nullopt if not an object or the key is missing.
+        std::optional<Element> find(std::string_view key) const;
+
+        /// \brief Find the element at \param index.
+        /// \returns std::nullopt if not an array or the index is out of range.
+        std::optional<Element> find(std::size_t index) const;
+
+        /// \brief Object accessor.
+        /// \throws bad_json_access if not an object
+        /// \throws std::out_of_range if the key is missing
+        Element at(std::string_view key) const;
+
+        /// \brief Array accessor.
+        /// \throws bad_json_access if not an array
+        /// \throws std::out_of_range if index >= size()
+        Element at(std::size_t index) const;
+
+        /// \brief The i-th member of an object.
+        /// \throws bad_json_access if not an object
+        /// \throws std::out_of_range if index >= size()
+        std::pair<std::string_view, Element> member(std::size_t index) const;
+
+        /// \brief Optionally retrieve the value as \tparam T.
+        /// Supports bool, arithmetic types (whole numbers are range checked),
+        /// std::string_view and std::string.
+        template<class T>
+        std::optional<T> get() const {
+            if constexpr (std::is_same_v<T, bool>) {
+                if (is_bool())
+                    return _node->boolean;
+            } else if constexpr (std::is_integral_v<T>) {
+                if (type() == Type::Integer && fits<T>(_node->integer))
+                    return static_cast<T>(_node->integer);
+            } else if constexpr (std::is_floating_point_v<T>) {
+                if (type() == Type::Double)
+                    return static_cast<T>(_node->number);
+                if (type() == Type::Integer)
+                    return static_cast<T>(_node->integer);
+            } else if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>) {
+                if (is_string())
+                    return T(std::string_view(_document->_strings).substr(_node->offset, _node->size));
+            } else {
+                static_assert(std::is_same_v<T, bool>, "CompactJson can not convert to the requested type");
+            }
+            return std::nullopt;
+        }
+
+        /// \brief Convert the value to a Json::get compatible value.
+        /// Whole numbers get the smallest of int, long, long long that can hold them.
+        std::optional<Json::Value> value() const;
+    };
+
+    /// \brief Parse \param text into the arenas.
+    /// Afterwards the validity flag is set accordingly.
+    explicit CompactJson(std::string_view text);
+
+    /// \brief Validity check. \returns true if the text is a valid document.
+    bool valid() const {
+        return _valid;
+    }
+
+    /// \brief Validity check for convenience.
+    explicit operator bool() const {
+        return valid();
+    }
+
+    /// \brief The object or array of the document.
+    /// \throws bad_json_access if the document is invalid
+    Element root() const;
+
+    /// \brief Number of keys of the object or elements of the array.
+    std::size_t size() const {
+        return _valid ? root().size() : 0;
+    }
+
+    /// \brief Find the value at \param path.
+    /// \see Json::get
+    std::optional<Element> find_path(const std::string& path) const;
+
+    /// \brief Find the value at the precompiled \param path.
+    std::optional<Element> find_path(const JsonPath& path) const;
+
+    /// \brief Optionally retrieve the value at \param path as \tparam T.
+    /// \see CompactJson::Element::get
+    template<class T>
+    std::optional<T> get(const std::string& path) const {
+        auto element = find_path(path);
+        return element ? element->get<T>() : std::nullopt;
+    }
+
+    /// \brief Optionally retrieve the value at the precompiled \param path as \tparam T.
+    template<class T>
+    std::optional<T> get(const JsonPath& path) const {
+        auto element = find_path(path);
+        return element ? element->get<T>() : std::nullopt;
+    }
+
+    /// \brief Bytes held by the arenas.
+    std::size_t memory_usage() const {
+        return _nodes.capacity() * sizeof(Node) + _strings.capacity();
+    }
+
+    /// \brief Convert the document to Json.
+    Json to_json() const;
+};
+
+}
+
+#endif //CORE_COMPACTJSON_HPP
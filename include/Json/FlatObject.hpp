@@ -0,0 +1,266 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_FLATOBJECT_HPP
+#define CORE_FLATOBJECT_HPP
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Core {
+
+/// \brief Insertion ordered map of string keys, the storage of JSON objects.
+/// Members are kept next to each other in a vector. Small objects are searched
+/// linearly, larger ones get an open addressing index on top that holds the
+/// hash of every key, computed once on insertion, so probing compares hashes
+/// before keys. Keys are std::string, so short keys are stored inline (SSO).
+/// Its size is that of a std::map, as it is stored inline in every Json.
+/// Inserting may move the members, references to them are invalidated.
+template<class Value>
+class FlatObject {
+public:
+    using value_type = std::pair<std::string, Value>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+private:
+    /// \brief Objects up to this size have no index.
+    static constexpr std::size_t linear_limit = 8;
+
+    /// \brief The members in insertion order.
+    std::vector<value_type> _members;
+
+    /// \brief Slot of the index.
+    struct Slot {
+        /// \brief Hash of the key (its lower bits).
+        std::uint32_t hash;
+
+        /// \brief 1 + the position of the member, 0 if the slot is empty.
+        std::uint32_t member;
+    };
+
+    /// \brief Open addressing index, empty for small objects.
+    /// Its size is a power of two, at least twice the number of members.
+    std::vector<Slot> _slots;
+
+    static std::size_t hash(std::string_view key) {
+        return std::hash<std::string_view>()(key);
+    }
+
+    /// \brief Hash of \param key for position(), only computed when there is an index.
+    std::size_t lookup_hash(std::string_view key) const {
+        return _slots.empty() ? 0 : hash(key);
+    }
+
+    /// \brief Position of \param key with \param key_hash (\see lookup_hash), size() if missing.
+    std::size_t position(std::string_view key, std::size_t key_hash) const {
+        if (_slots.empty()) {
+            for (std::size_t i = 0; i < _members.size(); ++i) {
+                if (_members[i].first == key)
+                    return i;
+            }
+            return _members.size();
+        }
+
+        const auto mask = _slots.size() - 1;
+        for (auto slot = key_hash & mask; _slots[slot].member != 0; slot = (slot + 1) & mask) {
+            const auto i = _slots[slot].member - 1;
+            if (_slots[slot].hash == static_cast<std::uint32_t>(key_hash) && _members[i].first == key)
+                return i;
+        }
+        return _members.size();
+    }
+
+    /// \brief Add the member at \param i with \param key_hash to the index.
+    void index(std::size_t i, std::size_t key_hash) {
+        const auto mask = _slots.size() - 1;
+        auto slot = key_hash & mask;
+        while (_slots[slot].member != 0)
+            slot = (slot + 1) & mask;
+        _slots[slot] = {static_cast<std::uint32_t>(key_hash), static_cast<std::uint32_t>(i + 1)};
+    }
+
+    /// \brief Remove the member at \param i with \param key_hash from the index,
+    /// the positions of the members after it are moved down by one.
+    void unindex(std::size_t i, std::size_t key_hash) {
+        const auto mask = _slots.size() - 1;
+        auto hole = key_hash & mask;
+        while (_slots[hole].member != i + 1)
+            hole = (hole + 1) & mask;
+
+        // Backward shift deletion: the slots probed after the hole move into it
+        // unless that would put them before their home slot, no tombstones needed
+        for (auto slot = (hole + 1) & mask; _slots[slot].member != 0; slot = (slot + 1) & mask) {
+            const auto home = _slots[slot].hash & mask;
+            if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+                _slots[hole] = _slots[slot];
+                hole = slot;
+            }
+        }
+        _slots[hole] = Slot{0, 0};
+
+        for (auto& slot : _slots) {
+            if (slot.member > i + 1)
+                --slot.member;
+        }
+    }
+
+    /// \brief Build the index from scratch if the object is large enough for one.
+    void reindex() {
+        _slots.clear();
+        if (_members.size() <= linear_limit)
+            return;
+
+        std::size_t capacity = 16;
+        while (capacity < 2 * _members.size())
+            capacity *= 2;
+        _slots.assign(capacity, Slot{0, 0});
+        for (std::size_t i = 0; i < _members.size(); ++i)
+            index(i, hash(_members[i].first));
+    }
+
+    /// \brief Append a member with a key known to be missing.
+    iterator append(std::string key, std::size_t key_hash, Value value) {
+        _members.emplace_back(std::move(key), std::move(value));
+
+        if (_members.size() > linear_limit && 2 * _members.size() > _slots.size())
+            reindex();
+        else if (!_slots.empty())
+            index(_members.size() - 1, key_hash);
+        return _members.end() - 1;
+    }
+
+public:
+    FlatObject() = default;
+
+    iterator begin() {
+        return _members.begin();
+    }
+
+    iterator end() {
+        return _members.end();
+    }
+
+    const_iterator begin() const {
+        return _members.begin();
+    }
+
+    const_iterator end() const {
+        return _members.end();
+    }
+
+    std::size_t size() const {
+        return _members.size();
+    }
+
+    bool empty() const {
+        return _members.empty();
+    }
+
+    void reserve(std::size_t size) {
+        _members.reserve(size);
+    }
+
+    void clear() {
+        _members.clear();
+        _slots.clear();
+    }
+
+    /// \brief Find the member \param key, end() if missing.
+    iterator find(std::string_view key) {
+        return begin() + static_cast<std::ptrdiff_t>(position(key, lookup_hash(key)));
+    }
+
+    const_iterator find(std::string_view key) const {
+        return begin() + static_cast<std::ptrdiff_t>(position(key, lookup_hash(key)));
+    }
+
+    /// \brief Access the member \param key.
+    /// \throws std::out_of_range if the key is missing
+    Value& at(std::string_view key) {
+        auto it = find(key);
+        if (it == end())
+            throw std::out_of_range("No such key");
+        return it->second;
+    }
+
+    const Value& at(std::string_view key) const {
+        auto it = find(key);
+        if (it == end())
+            throw std::out_of_range("No such key");
+        return it->second;
+    }
+
+    /// \brief Access the member \param key, a default constructed value is appended if it is missing.
+    Value& operator[](std::string_view key) {
+        const auto key_hash = lookup_hash(key);
+        const auto i = position(key, key_hash);
+        if (i != _members.size())
+            return _members[i].second;
+        return append(std::string(key), key_hash, Value())->second;
+    }
+
+    /// \brief Append the member \param key if it is missing.
+    /// \returns the member and whether it was appended.
+    std::pair<iterator, bool> emplace(std::string_view key, Value value) {
+        const auto key_hash = lookup_hash(key);
+        const auto i = position(key, key_hash);
+        if (i != _members.size())
+            return {begin() + static_cast<std::ptrdiff_t>(i), false};
+        return {append(std::string(key), key_hash, std::move(value)), true};
+    }
+
+    /// \brief Set the member \param key, appended if it is missing.
+    /// \returns the member and whether it was appended.
+    std::pair<iterator, bool> insert_or_assign(std::string key, Value value) {
+        const auto key_hash = lookup_hash(key);
+        const auto i = position(key, key_hash);
+        if (i != _members.size()) {
+            _members[i].second = std::move(value);
+            return {begin() + static_cast<std::ptrdiff_t>(i), false};
+        }
+        return {append(std::move(key), key_hash, std::move(value)), true};
+    }
+
+    /// \brief Remove the member \param key, the order of the others is kept.
+    /// The index is patched in place rather than rebuilt, no key is hashed again.
+    /// \returns the number of members removed.
+    std::size_t erase(std::string_view key) {
+        const auto key_hash = lookup_hash(key);
+        const auto i = position(key, key_hash);
+        if (i == _members.size())
+            return 0;
+
+        if (!_slots.empty())
+            unindex(i, key_hash);
+        _members.erase(_members.begin() + static_cast<std::ptrdiff_t>(i));
+        return 1;
+    }
+
+    /// \brief Equality regardless of the order of the members.
+    bool operator==(const FlatObject& other) const {
+        if (size() != other.size())
+            return false;
+
+        for (const auto& [key, value] : _members) {
+            const auto j = other.position(key, other.lookup_hash(key));
+            if (j == other.size() || !(value == other._members[j].second))
+                return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const FlatObject& other) const {
+        return !(*this == other);
+    }
+};
+
+}
+
+#endif //CORE_FLATOBJECT_HPP
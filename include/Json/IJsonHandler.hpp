@@ -0,0 +1,100 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_IJSONHANDLER_HPP
+#define CORE_IJSONHANDLER_HPP
+
+#include <string_view>
+
+namespace Core {
+
+/// \brief Receiver of the events of JsonSaxParser.
+/// Every event returns whether parsing should go on, returning false stops the
+/// parser (e.g. once the fields of interest are found).
+/// Views passed to the events are only valid during the call.
+class IJsonHandler {
+public:
+    virtual ~IJsonHandler() = default;
+
+    /// \brief An object is opened.
+    virtual bool on_object_begin() = 0;
+
+    /// \brief The innermost open object is closed.
+    virtual bool on_object_end() = 0;
+
+    /// \brief An array is opened.
+    virtual bool on_array_begin() = 0;
+
+    /// \brief The innermost open array is closed.
+    virtual bool on_array_end() = 0;
+
+    /// \brief Key of the next member of the innermost object, escape sequences decoded.
+    virtual bool on_key(std::string_view key) = 0;
+
+    /// \brief String value, escape sequences decoded (\see JsonCursor::unescape).
+    virtual bool on_string(std::string_view value) = 0;
+
+    /// \brief Number value, the text as it conforms to the JSON grammar.
+    virtual bool on_number(std::string_view number) = 0;
+
+    /// \brief true or false.
+    virtual bool on_bool(bool value) = 0;
+
+    /// \brief null.
+    virtual bool on_null() = 0;
+};
+
+/// \brief Handler that ignores every event.
+/// Derive from it to handle only the events of interest.
+class BaseJsonHandler : public IJsonHandler {
+public:
+    /// \copydoc IJsonHandler::on_object_begin
+    bool on_object_begin() override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_object_end
+    bool on_object_end() override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_array_begin
+    bool on_array_begin() override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_array_end
+    bool on_array_end() override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_key
+    bool on_key(std::string_view) override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_string
+    bool on_string(std::string_view) override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_number
+    bool on_number(std::string_view) override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_bool
+    bool on_bool(bool) override {
+        return true;
+    }
+
+    /// \copydoc IJsonHandler::on_null
+    bool on_null() override {
+        return true;
+    }
+};
+
+}
+
+#endif //CORE_IJSONHANDLER_HPP
@@ -13,12 +13,19 @@
 #include <list>
 #include <string>
 #include <stack>
-#include <map>
+#include <string_view>
+#include <type_traits>
 
 #include "Utils/ValueWrapper.hpp"
+#include "Json/FlatObject.hpp"
+#include "Json/JsonPath.hpp"
 
 namespace Core {
 
+class JsonBuilder;
+class JsonCursor;
+class JsonStructuralIndex;
+
 /// \brief Exception that is thrown in case bad access occurs in when dealing with JSONs.
 class bad_json_access : public std::exception {
 private:
@@ -29,22 +36,20 @@ public:
         return _message.c_str();
     }
 };
-    
-    
-/// \brief Exception that is thrown in case bad path is provided when dealing with JSONs.
-class bad_json_path : public std::exception {
-private:
-    std::string _message;
-public:
-    bad_json_path(std::string message) : _message(std::move(message)) {}
-    const char * what() const noexcept {
-        return _message.c_str();
-    }
-};
+
 
 /// \brief JSON object representation.
 /// Provides means to handle JSON objects, parses, prettyfies, prints in the appropriate manner.
 class Json {
+    friend class CompactJson;
+    friend class JsonBinder;
+    friend class JsonBuilder;
+    friend class JsonCbor;
+    friend class JsonParallelParser;
+    friend class JsonPatch;
+    friend class JsonSchema;
+    friend class LazyJson;
+    friend class JsonWriter;
 public:
     /// \brief Representation of Null values.
     struct Null {
@@ -57,10 +62,9 @@ private:
 
     using Value = ValueWrapper<Null, bool, int, long, long long, double, std::string, Json>;
     using MaybeValue = std::optional<Value>;
-    using JsonObject = std::map<std::string, Value>;
+    using JsonObject = FlatObject<Value>;
     using JsonArray = std::vector<Value>;
     using ValueContainer = std::variant<JsonObject, JsonArray>;
-    using ParsedValue = std::pair<Value, unsigned int>;
 private:
     
     /// \brief Internal representatiton of the contained data.
@@ -92,34 +96,45 @@ private:
     /// \brief Flag to represent if the construction was successful.
     bool _valid = false;
 
-    /// \brief Parses the path received in path.
-    /// Produces a mix of std::size_t and std::string values.
+    /// \brief Converts \param path to a mix of std::size_t and std::string values.
     /// Internal use only.
-    /// \see Json::get
-    static PropList parse_path(std::string path);
-    
-    /// \brief Parses json of object type
-    static std::optional<ParsedValue> parse_object(const std::string_view object_string);
+    /// \see Json::set
+    static PropList parse_path(const JsonPath& path);
     
-    /// \brief Parses json of array type
-    static std::optional<ParsedValue> parse_array(const std::string_view object_string);
+    /// \brief Maximum nesting depth of objects and arrays accepted by the parser.
+    static constexpr std::size_t max_depth = 1024;
+
+    /// \brief Parses json of object type, the cursor must be at the opening brace.
+    /// Members are moved into \param object as they are parsed.
+    /// \tparam Cursor JsonCursor or JsonStructuralIndex::Cursor
+    template<class Cursor>
+    static bool parse_object(Cursor& cursor, JsonObject& object, std::size_t depth);
+
+    /// \brief Parses json of array type, the cursor must be at the opening bracket.
+    /// Elements are moved into \param array as they are parsed.
+    template<class Cursor>
+    static bool parse_array(Cursor& cursor, JsonArray& array, std::size_t depth);
+
+    /// \brief Parses the value at the cursor into \param value.
+    /// Parses strings like "Hello World", null, true, false, 1e-35, objects and arrays
+    /// that conform to the JSON specification.
+    template<class Cursor>
+    static bool parse_value(Cursor& cursor, Value& value, std::size_t depth);
+
+    /// \brief Parses the whole input of the cursor into this object.
+    /// Afterwards the validity flag is set accordingly.
+    template<class Cursor>
+    void parse_document(Cursor& cursor);
 
-    /// \brief Parses a string. The string_view must start after the first quote.
-    static std::optional<std::string> parse_string(const std::string_view key_string);
-    
-    /// \brief Parses the value received in value_string.
-    /// \return optionally the Value received in the string.
-    /// Parses strings like "Hello World", null, true, false, 1e-35 that conform to the JSON specification.
-    static std::optional<ParsedValue> parse_value(const std::string_view &value_string);
-private:
-    /// \brief Get the property represented by the property list propList
-    /// Internal use only to avoid copying the list multiple times.
-    /// \see Json::get
-    std::optional<Value> _get(PropList prop_list) const;
+    /// \brief Parses the \param count comma separated values of \param text into \param values.
+    /// The values are at nesting \param depth, the text must hold nothing else.
+    static bool parse_values(std::string_view text, Value* values, std::size_t count, std::size_t depth);
 
-    /// \brief Pretty-print the JSON
-    /// \see Json::operator<<
-    void print(std::ostream& os, unsigned& tab_count) const;
+    /// \brief Converts the text of a number (\see JsonCursor::read_number) to a Value.
+    /// Whole numbers get the smallest of int, long, long long that can hold them.
+    /// \returns std::nullopt if the number is out of the range of long long or double.
+    static std::optional<Value> parse_number(std::string_view number);
+private:
 
     /// \brief Set the value in the object with the path propList.
     /// Internal use only to avoid the mis-usage of propList.
@@ -180,15 +195,57 @@ private:
     /// \see Json::createArray
     Json(const JsonArray& array) : _data(array), _valid(true) {}
 
+    /// \brief Create a JSON array taking over the data provided in array.
+    Json(JsonArray&& array) : _data(std::move(array)), _valid(true) {}
+
     /// \brief Create a JSON object with the data provided in object.
     /// \see Json::createObject
     Json(const JsonObject& object) : _data(object), _valid(true) {}
+
+    /// \brief Create a JSON object taking over the data provided in object.
+    Json(JsonObject&& object) : _data(std::move(object)), _valid(true) {}
 public:
     /// \brief Parse json_string.
     /// Afterwards the validity flag is set accordingly.
     /// \see Json::isValid
     Json(const std::string& json_string);
 
+    /// \brief Parse the text indexed by \param index (stage 2 of the two-stage parser).
+    /// The tokens are taken from the index, the text between them is not scanned.
+    /// Produces the same result as parsing the text directly.
+    /// \see JsonStructuralIndex
+    explicit Json(const JsonStructuralIndex& index);
+
+    /// \brief Parse \param text without copying it into a string first.
+    /// \returns an invalid Json if the text is not a valid document.
+    static Json parse(std::string_view text);
+
+    /// \brief Result of Json::validate.
+    struct Validation {
+        bool valid = false;
+
+        /// \brief Offset of the first invalid byte, the size of the text if it is valid or ends early.
+        std::size_t offset = 0;
+
+        explicit operator bool() const {
+            return valid;
+        }
+    };
+
+    /// \brief Check that \param text is a well-formed document without building it.
+    /// Nothing is allocated, the nesting is tracked in a fixed size bit stack. The tokens
+    /// are read by the JsonCursor of Json::parse, so the grammar is the same, and so is
+    /// the range of numbers: they are converted in place and rejected if they do not
+    /// fit (long long for integers, double otherwise).
+    static Validation validate(std::string_view text);
+
+    /// \brief Parse the file at \param path.
+    /// The file is memory mapped and parsed straight from the mapping, so its text
+    /// is not copied into a string first, only the strings of the document are.
+    /// \returns an invalid Json if the file can not be read.
+    /// \see MappedFile, LazyJson::load for a document that refers to the mapping
+    static Json load(const std::string& path);
+
     /// \brief Check the size of the underlying object.
     /// In case of Objects, it returns the number of keys, in case of array, it returns the number of data held.
     std::size_t size() const;
@@ -198,6 +255,13 @@ public:
     /// \param fallback_value This value gets returned if the key sequence is not available in the object.
     template<class T>
     T get(const std::string &path, T fallback_value) const {
+        return get<T>(JsonPath(path), std::move(fallback_value));
+    }
+
+    /// \brief Retrieve the value at the precompiled \param path.
+    /// \see Json::get
+    template<class T>
+    T get(const JsonPath& path, T fallback_value) const {
         auto optional = get<T>(path);
         return optional ? *optional : fallback_value;
     }
@@ -206,12 +270,52 @@ public:
     /// \see Json::get
     template<class T>
     std::optional<T> get(const std::string &path) const {
-        auto variant = get(path);
-        if(variant && std::holds_alternative<T>(*variant))
-            return std::get<T>(*variant);
+        return get<T>(JsonPath(path));
+    }
+
+    /// \brief Optionally retrieve the value at the precompiled \param path.
+    /// Looking up the path does not allocate, only the returned value is copied.
+    /// Strings can be retrieved as std::string_view referring to the json.
+    /// \see Json::get
+    template<class T>
+    std::optional<T> get(const JsonPath& path) const {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            if(const auto* string = get_if<std::string>(path))
+                return std::string_view(*string);
+        } else {
+            if(const auto* value = get_if<T>(path))
+                return *value;
+        }
         return std::nullopt;
     }
 
+    /// \brief Find the value at \param path without copying anything.
+    /// The pointer is valid until the json is modified.
+    /// \returns nullptr if there is no such value.
+    const Value* find(const JsonPath& path) const;
+
+    /// \brief Find the value at \param path without copying anything.
+    /// \see Json::find
+    const Value* find(const std::string& path) const {
+        return find(JsonPath(path));
+    }
+
+    /// \brief Retrieve the value at \param path in place, e.g. a nested Json or a string.
+    /// The pointer is valid until the json is modified.
+    /// \returns nullptr if there is no such value or it is not of type \tparam T.
+    template<class T>
+    const T* get_if(const JsonPath& path) const {
+        const auto* value = find(path);
+        return value ? std::get_if<T>(&value->to_std_variant()) : nullptr;
+    }
+
+    /// \brief Retrieve the value at \param path in place.
+    /// \see Json::get_if
+    template<class T>
+    const T* get_if(const std::string& path) const {
+        return get_if<T>(JsonPath(path));
+    }
+
     /// \brief Get part of the json.
     /// \param path Path in the json object.
     /// \code
@@ -248,6 +352,10 @@ public:
     /// \endcode
     std::optional<Value> get(const std::string& path) const;
 
+    /// \brief Get part of the json at the precompiled \param path.
+    /// \see Json::get
+    std::optional<Value> get(const JsonPath& path) const;
+
     /// \brief Set value based on path.
     /// If a key does not exist in an object, it gets created with the appropriate type.
     /// Arrays are filled with null until the desired index, existing keys/indexes are overwritten.
@@ -268,13 +376,28 @@ public:
     /// \endcode
     template<class T>
     void set(const std::string &path, const T& value) {
+        set(JsonPath(path), value);
+    }
+
+    /// \brief Set value based on the precompiled \param path.
+    /// \see Json::set
+    template<class T>
+    void set(const JsonPath& path, const T& value) {
         PropList prop_list = parse_path(path);
         if(prop_list.empty())
             throw bad_json_path("Empty or invalid path");
-        
+
         _set(prop_list, value);
     }
 
+    /// \brief Members of the object in insertion order, for iteration without copying.
+    /// \throws bad_json_access if not an object
+    const JsonObject& members() const;
+
+    /// \brief Elements of the array for iteration without copying.
+    /// \throws bad_json_access if not an array
+    const JsonArray& elements() const;
+
     /// \brief Object accessor
     /// \throws bad_json_access if not an object
     const Value& at(const std::string& property) const;
@@ -309,6 +432,10 @@ public:
     /// \throws bad_json_access if not an array
     void push_back(const Value& value);
 
+    /// \brief Move an object to the end of the array.
+    /// \throws bad_json_access if not an array
+    void push_back(Value&& value);
+
     /// \brief Pop the object in the end of the array.
     /// \throws bad_json_access if not an array
     void pop_back();
@@ -333,6 +460,7 @@ public:
     }
 
     /// \brief Pretty-print the object.
+    /// The text is built by a JsonWriter and written to the stream at once.
     friend std::ostream& operator<<(std::ostream& os, const Json& json);
 
     /// \brief Factory function, creates empty object.
@@ -0,0 +1,248 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONBINDING_HPP
+#define CORE_JSONBINDING_HPP
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <Json/Json.hpp>
+#include <Json/JsonCursor.hpp>
+#include <Json/JsonWriter.hpp>
+
+namespace Core {
+
+/// \brief Member \param member of \tparam Class, named \param name in JSON.
+template<class Class, class Member>
+struct JsonField {
+    std::string_view name;
+    Member Class::* member;
+};
+
+/// \brief Create a JsonField, \see CORE_JSON_FIELD.
+template<class Class, class Member>
+constexpr JsonField<Class, Member> json_field(std::string_view name, Member Class::* member) {
+    return {name, member};
+}
+
+/// \brief Field of \param Type named after its \param member.
+#define CORE_JSON_FIELD(Type, member) ::Core::json_field(#member, &Type::member)
+
+/// \brief Binding of a struct to a JSON object, specialize it to list the members.
+/// \code
+/// template<>
+/// struct Core::JsonBinding<Person> {
+///     static constexpr auto fields = std::make_tuple(CORE_JSON_FIELD(Person, name),
+///                                                    Core::json_field("years", &Person::age));
+/// };
+/// \endcode
+template<class T>
+struct JsonBinding {};
+
+/// \brief Whether JsonBinding is specialized for \tparam T.
+template<class T, class = void>
+struct is_json_bound : std::false_type {};
+
+template<class T>
+struct is_json_bound<T, std::void_t<decltype(JsonBinding<T>::fields)>> : std::true_type {};
+
+/// \brief Serialization of bound structs without a Json in between.
+/// Writing appends the members straight to a JsonWriter, reading fills them
+/// straight from a JsonCursor. The members may be bool, numbers, std::string,
+/// std::optional (null if empty), std::vector and bound structs.
+/// Reading keeps the value of members missing from the text and skips unknown
+/// keys, a value of the wrong type fails the whole read.
+class JsonBinder {
+private:
+    template<class T>
+    struct is_optional : std::false_type {};
+
+    template<class T>
+    struct is_optional<std::optional<T>> : std::true_type {};
+
+    template<class T>
+    struct is_vector : std::false_type {};
+
+    template<class T, class Allocator>
+    struct is_vector<std::vector<T, Allocator>> : std::true_type {};
+
+    /// \brief Skip the value at the cursor, nested \param depth deep.
+    static bool skip_value(JsonCursor& cursor, std::size_t depth);
+
+    template<class T>
+    static void write_value(JsonWriter& writer, const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            writer.write_raw(value ? "true" : "false");
+        } else if constexpr (std::is_integral_v<T>) {
+            char digits[24];
+            const auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+            writer.write_raw(std::string_view(digits, static_cast<std::size_t>(end - digits)));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            writer.write_number(static_cast<double>(value));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            writer.write_string(value);
+        } else if constexpr (is_optional<T>::value) {
+            if (value)
+                write_value(writer, *value);
+            else
+                writer.write_raw("null");
+        } else if constexpr (is_vector<T>::value) {
+            writer.write_raw("[");
+            for (std::size_t i = 0; i < value.size(); ++i) {
+                if (i > 0)
+                    writer.write_raw(",");
+                write_value(writer, value[i]);
+            }
+            writer.write_raw("]");
+        } else {
+            static_assert(is_json_bound<T>::value, "JsonBinding is not specialized for the type");
+            writer.write_raw("{");
+            bool first = true;
+            std::apply([&writer, &value, &first](const auto&... field) {
+                ((writer.write_raw(first ? "" : ","), first = false, writer.write_string(field.name).write_raw(":"),
+                  write_value(writer, value.*(field.member))), ...);
+            }, JsonBinding<T>::fields);
+            writer.write_raw("}");
+        }
+    }
+
+    /// \brief Read the value at the cursor into \param value, nested \param depth deep.
+    template<class T>
+    static bool read_value(JsonCursor& cursor, T& value, std::size_t depth) {
+        if constexpr (std::is_same_v<T, bool>) {
+            value = cursor.peek() == 't';
+            return cursor.consume_literal(value ? "true" : "false");
+        } else if constexpr (std::is_integral_v<T>) {
+            cursor.skip_whitespace();
+            const auto number = cursor.read_number();
+            if (!number)
+                return false;
+            const auto* end = number->data() + number->size();
+            const auto result = std::from_chars(number->data(), end, value);
+            return result.ec == std::errc() && result.ptr == end;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            cursor.skip_whitespace();
+            const auto number = cursor.read_number();
+            double converted = 0;
+            if (!number || !JsonCursor::to_double(*number, converted))
+                return false;
+            // Numbers out of the range of T (i.e. float) are rejected
+            value = static_cast<T>(converted);
+            return std::isfinite(value) && (value != 0 || converted == 0);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (cursor.peek() != '"')
+                return false;
+            auto string = cursor.read_string();
+            if (!string)
+                return false;
+            value = std::move(*string);
+            return true;
+        } else if constexpr (is_optional<T>::value) {
+            if (cursor.peek() == 'n') {
+                value.reset();
+                return cursor.consume_literal("null");
+            }
+            return read_value(cursor, value.emplace(), depth);
+        } else if constexpr (is_vector<T>::value) {
+            value.clear();
+            if (depth + 1 > Json::max_depth || !cursor.consume('['))
+                return false;
+            if (cursor.consume(']'))
+                return true;
+            do {
+                if (!read_value(cursor, value.emplace_back(), depth + 1))
+                    return false;
+            } while (cursor.consume(','));
+            return cursor.consume(']');
+        } else {
+            static_assert(is_json_bound<T>::value, "JsonBinding is not specialized for the type");
+            return read_object(cursor, value, depth + 1);
+        }
+    }
+
+    /// \brief Read the object at the cursor into the members of \param object.
+    template<class T>
+    static bool read_object(JsonCursor& cursor, T& object, std::size_t depth) {
+        if (depth > Json::max_depth || !cursor.consume('{'))
+            return false;
+        if (cursor.consume('}'))
+            return true;
+
+        std::string unescaped;
+        do {
+            if (cursor.peek() != '"')
+                return false;
+            const auto raw_key = cursor.read_raw_string();
+            if (!raw_key || !cursor.consume(':'))
+                return false;
+
+            auto key = *raw_key;
+            if (key.find('\\') != std::string_view::npos) {
+                unescaped = JsonCursor::unescape(key);
+                key = unescaped;
+            }
+
+            bool matched = false;
+            bool read = true;
+            std::apply([&](const auto&... field) {
+                ((!matched && field.name == key
+                  ? (matched = true, read = read_value(cursor, object.*(field.member), depth))
+                  : false), ...);
+            }, JsonBinding<T>::fields);
+
+            if (!(matched ? read : skip_value(cursor, depth)))
+                return false;
+        } while (cursor.consume(','));
+
+        return cursor.consume('}');
+    }
+
+public:
+    /// \brief Append \param value to \param writer (minified).
+    template<class T>
+    static void write(JsonWriter& writer, const T& value) {
+        write_value(writer, value);
+    }
+
+    /// \brief Serialize \param value.
+    template<class T>
+    static std::string to_string(const T& value) {
+        JsonWriter writer;
+        write_value(writer, value);
+        return writer.take();
+    }
+
+    /// \brief Read \param text into \param value.
+    /// \returns false if the text is not a valid document of the type, \param value may be partially filled.
+    template<class T>
+    static bool read(std::string_view text, T& value) {
+        JsonCursor cursor(text);
+        if (!read_value(cursor, value, 0))
+            return false;
+        cursor.skip_whitespace();
+        return cursor.at_end();
+    }
+
+    /// \brief Read \param text into a default constructed \tparam T.
+    /// \returns std::nullopt if the text is not a valid document of the type.
+    template<class T>
+    static std::optional<T> parse(std::string_view text) {
+        std::optional<T> value(std::in_place);
+        if (!read(text, *value))
+            return std::nullopt;
+        return value;
+    }
+};
+
+}
+
+#endif //CORE_JSONBINDING_HPP
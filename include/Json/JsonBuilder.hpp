@@ -0,0 +1,107 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONBUILDER_HPP
+#define CORE_JSONBUILDER_HPP
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Json/IJsonHandler.hpp>
+#include <Json/Json.hpp>
+
+namespace Core {
+
+/// \brief Handler building a Json from the events of a JsonSaxParser.
+/// Values are moved into their parents as soon as they are complete, so only
+/// the path to the value being parsed is held apart from the document.
+class JsonBuilder : public IJsonHandler {
+private:
+    /// \brief A container being built.
+    struct Frame {
+        /// \brief The object or array.
+        Json container;
+
+        /// \brief Key of the container in its parent object.
+        std::string key;
+
+        /// \brief Open an object or, if \param array, an array.
+        Frame(bool array, std::string key)
+            : container(array ? Json::create_array() : Json::create_object()), key(std::move(key)) {}
+    };
+
+    /// \brief Containers from the document to the innermost open one.
+    std::vector<Frame> _stack;
+
+    /// \brief Key of the next member of the innermost object.
+    std::string _key;
+
+    /// \brief The completed document.
+    std::optional<Json> _document;
+
+    /// \brief Whether to stop the parser when the document is complete.
+    bool _stop_at_end;
+
+    /// \brief Set if a value can not be represented (e.g. a number out of range).
+    bool _failed = false;
+
+    /// \brief Add \param value to the innermost open container.
+    bool add(Json::Value value);
+
+public:
+    /// \brief Construct the builder.
+    /// \param stop_at_end stop the parser when the document is complete, so
+    /// the text following it can be handled separately.
+    explicit JsonBuilder(bool stop_at_end = false) : _stop_at_end(stop_at_end) {}
+
+    /// \copydoc IJsonHandler::on_object_begin
+    bool on_object_begin() override;
+
+    /// \copydoc IJsonHandler::on_object_end
+    bool on_object_end() override;
+
+    /// \copydoc IJsonHandler::on_array_begin
+    bool on_array_begin() override;
+
+    /// \copydoc IJsonHandler::on_array_end
+    bool on_array_end() override;
+
+    /// \copydoc IJsonHandler::on_key
+    bool on_key(std::string_view key) override;
+
+    /// \copydoc IJsonHandler::on_string
+    bool on_string(std::string_view value) override;
+
+    /// \copydoc IJsonHandler::on_number
+    bool on_number(std::string_view number) override;
+
+    /// \copydoc IJsonHandler::on_bool
+    bool on_bool(bool value) override;
+
+    /// \copydoc IJsonHandler::on_null
+    bool on_null() override;
+
+    /// \brief Check if the document is complete.
+    bool complete() const {
+        return _document.has_value();
+    }
+
+    /// \brief Check if a value could not be represented.
+    bool failed() const {
+        return _failed;
+    }
+
+    /// \brief Take the completed document and start over.
+    /// \returns std::nullopt if the document is not complete.
+    std::optional<Json> take();
+
+    /// \brief Drop everything built so far.
+    void reset();
+};
+
+}
+
+#endif //CORE_JSONBUILDER_HPP
@@ -0,0 +1,76 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONCBOR_HPP
+#define CORE_JSONCBOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Json/Json.hpp>
+
+namespace Core {
+
+/// \brief Conversion between Json and CBOR (RFC 8949), a compact binary encoding.
+/// Encoding uses the shortest form of every length and of int and long values,
+/// and encodes doubles as single precision floats when that is exact. long long
+/// values always take the 8-byte argument.
+/// Whole numbers decode to the smallest of int, long, long long that can hold
+/// them, as when parsing text, so a document parsed from text round-trips.
+/// An 8-byte argument 4 bytes could hold decodes to long long, so long long
+/// values within 32 bits round-trip. Other widths are not kept: a long within
+/// the range of int decodes to int, and where long has 64 bits a long long out
+/// of 32 bits decodes to long.
+class JsonCbor {
+private:
+    /// \brief Decoding state.
+    struct Reader {
+        const std::uint8_t* data;
+        std::size_t size;
+        std::size_t position = 0;
+    };
+
+    static void encode_head(std::uint8_t major, std::uint64_t argument, std::vector<std::uint8_t>& output);
+    static void encode_value(const Json::Value& value, std::vector<std::uint8_t>& output);
+    static void encode_json(const Json& json, std::vector<std::uint8_t>& output);
+
+    /// \brief Read the initial byte and the argument of a data item.
+    /// The argument of indefinite lengths (and the break code) is std::nullopt.
+    static bool decode_head(Reader& reader, std::uint8_t& initial, std::optional<std::uint64_t>& argument);
+    static bool decode_string(Reader& reader, std::optional<std::uint64_t> length, std::string& string);
+    static bool decode_value(Reader& reader, Json::Value& value, std::size_t depth);
+    static bool decode_container(Reader& reader, bool object, std::optional<std::uint64_t> size,
+                                 Json::Value& value, std::size_t depth);
+
+public:
+    /// \brief Append the encoding of \param json to \param output.
+    static void encode(const Json& json, std::vector<std::uint8_t>& output);
+
+    /// \brief Encode \param json.
+    static std::vector<std::uint8_t> encode(const Json& json) {
+        std::vector<std::uint8_t> output;
+        encode(json, output);
+        return output;
+    }
+
+    /// \brief Decode the array or map of \param size bytes at \param data.
+    /// Definite and indefinite lengths and half, single and double precision
+    /// floats are accepted, tags are ignored. Byte strings, non-string keys,
+    /// simple values other than null, true and false, integers out of the range
+    /// of long long and trailing bytes are not.
+    /// \returns std::nullopt if the data can not be decoded.
+    static std::optional<Json> decode(const std::uint8_t* data, std::size_t size);
+
+    /// \brief Decode \param data.
+    /// \see JsonCbor::decode
+    static std::optional<Json> decode(const std::vector<std::uint8_t>& data) {
+        return decode(data.data(), data.size());
+    }
+};
+
+}
+
+#endif //CORE_JSONCBOR_HPP
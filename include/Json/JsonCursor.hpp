@@ -0,0 +1,124 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONCURSOR_HPP
+#define CORE_JSONCURSOR_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Core {
+
+/// \brief Forward-only cursor over JSON text.
+/// Lexical building block of the parsers. Every operation consumes input from the
+/// current position and never moves backwards, so a document is scanned exactly once.
+/// Operations that fail leave the cursor at the offending character.
+class JsonCursor {
+private:
+    /// \brief The text being parsed. Not owned.
+    std::string_view _input;
+
+    /// \brief Offset of the next unprocessed character.
+    std::size_t _position = 0;
+
+    /// \brief Read a string, \see JsonCursor::read_raw_string.
+    /// \param escaped is set if the string contains escape sequences.
+    std::optional<std::string_view> scan_string(bool& escaped);
+
+public:
+    /// \brief Construct a cursor at the beginning of \param input.
+    explicit JsonCursor(std::string_view input) : _input(input) {}
+
+    /// \brief Offset of the next unprocessed character.
+    std::size_t position() const {
+        return _position;
+    }
+
+    /// \brief The whole text being parsed.
+    std::string_view input() const {
+        return _input;
+    }
+
+    /// \brief Check if every character is processed.
+    bool at_end() const {
+        return _position >= _input.size();
+    }
+
+    /// \brief Whitespace as defined by the JSON specification.
+    static bool is_whitespace(char character) {
+        return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+    }
+
+    /// \brief Skip whitespace characters.
+    void skip_whitespace() {
+        while (_position < _input.size() && is_whitespace(_input[_position]))
+            ++_position;
+    }
+
+    /// \brief Skip whitespace, then return the next character without consuming it.
+    /// \returns '\0' at the end of the input.
+    char peek() {
+        skip_whitespace();
+        return at_end() ? '\0' : _input[_position];
+    }
+
+    /// \brief Skip whitespace, then consume \param expected if it is the next character.
+    bool consume(char expected) {
+        if (peek() != expected)
+            return false;
+        ++_position;
+        return true;
+    }
+
+    /// \brief Consume \param literal (e.g. true, false, null) if it is next.
+    /// Otherwise the cursor stops at the first character that differs.
+    bool consume_literal(std::string_view literal);
+
+    /// \brief Offset of the first quote, backslash or control character of \param text at
+    /// or after \param position, the size of the text if there is none.
+    /// The characters that end a run of plain string content, 16 are checked at a time with SSE2.
+    static std::size_t find_special_character(std::string_view text, std::size_t position);
+
+    /// \brief Read a string, the cursor must be at the opening quote.
+    /// Escape sequences are decoded, \see JsonCursor::unescape.
+    std::optional<std::string> read_string();
+
+    /// \brief Read a string without copying it, \see JsonCursor::read_string.
+    /// Escape sequences are validated but kept as they are.
+    /// \returns the text between the quotes.
+    std::optional<std::string_view> read_raw_string();
+
+    /// \brief Decode the escape sequences of \param raw, a string validated by
+    /// JsonCursor::read_raw_string, and append the result to \param output.
+    /// \\uXXXX sequences are encoded in UTF-8, surrogate pairs are combined and
+    /// unpaired surrogates are replaced by U+FFFD.
+    static void unescape(std::string_view raw, std::string& output);
+
+    /// \brief Decode the escape sequences of \param raw, \see JsonCursor::unescape.
+    static std::string unescape(std::string_view raw) {
+        std::string output;
+        unescape(raw, output);
+        return output;
+    }
+
+    /// \brief Compare \param raw, a string validated by JsonCursor::read_raw_string,
+    /// to the decoded \param text without decoding it into a new string.
+    static bool unescaped_equals(std::string_view raw, std::string_view text);
+
+    /// \brief Read a number conforming to the JSON grammar.
+    /// \returns the text of the number.
+    std::optional<std::string_view> read_number();
+
+    /// \brief Convert \param number, the text of a number read by read_number, to
+    /// \param value. Uses floating point std::from_chars where the standard library
+    /// has it (GCC 11 and later), std::strtod with the decimal point of the C locale
+    /// otherwise. \returns false if the number does not fit a double.
+    static bool to_double(std::string_view number, double& value);
+};
+
+}
+
+#endif //CORE_JSONCURSOR_HPP
@@ -0,0 +1,212 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONLINES_HPP
+#define CORE_JSONLINES_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Json/Json.hpp>
+#include <Json/JsonWriter.hpp>
+#include <FileManager/MappedFile.hpp>
+#include <ThreadPool/ThreadPool.hpp>
+
+namespace Core {
+
+/// \brief Reader of JSON Lines (NDJSON): one document per line.
+/// The text is split into chunks that end at line ends, the chunks are parsed in
+/// parallel on a ThreadPool and the records are handed to a callback on the
+/// calling thread, in the order of the lines or as soon as their chunk is parsed.
+/// Blank lines are skipped, lines that are not valid documents yield invalid Json.
+class JsonLines {
+public:
+    /// \brief Order in which the records are delivered.
+    enum class Order {
+        Ordered,    ///< In the order of the lines.
+        Unordered   ///< Chunk by chunk as they are parsed, the lines of a chunk in order.
+    };
+
+    struct Options {
+        /// \brief Approximate size of the chunks in bytes, a chunk holds one line at least.
+        std::size_t chunk_size = 1 << 16;
+
+        Order order = Order::Ordered;
+    };
+
+private:
+    /// \brief Results of the chunks, shared by the jobs and the reader.
+    class Completion {
+    private:
+        std::mutex _mutex;
+        std::condition_variable _finished;
+
+        /// \brief Records of the chunks, emptied when delivered.
+        std::vector<std::vector<Json>> _records;
+        std::vector<bool> _done;
+
+        /// \brief Chunks a job or the reader started parsing.
+        std::vector<bool> _claimed;
+
+        /// \brief Chunks finished but not delivered yet, in the order they finished.
+        std::deque<std::size_t> _ready;
+
+        std::size_t _finished_count = 0;
+        std::exception_ptr _error;
+
+    public:
+        explicit Completion(std::size_t chunks) : _records(chunks), _done(chunks, false), _claimed(chunks, false) {}
+
+        /// \brief Claim \param chunk for parsing.
+        /// \returns false if it was claimed already.
+        bool claim(std::size_t chunk);
+
+        /// \brief Claim the chunks below \param count that are not claimed yet, they count as finished.
+        void cancel(std::size_t count);
+
+        /// \brief Store the records of \param chunk.
+        void finish(std::size_t chunk, std::vector<Json> records);
+
+        /// \brief Record that parsing \param chunk threw \param error.
+        void fail(std::size_t chunk, std::exception_ptr error);
+
+        /// \brief Wait for \param chunk and take its records.
+        /// \throws the exception of a job that failed
+        std::vector<Json> take(std::size_t chunk);
+
+        /// \brief Wait for any chunk not taken yet and take its records.
+        /// \throws the exception of a job that failed
+        std::vector<Json> take_any();
+
+        /// \brief Wait until \param count chunks are finished.
+        void wait(std::size_t count);
+    };
+
+    /// \brief Parse \param chunk and store its records in \param completion, the chunk must be claimed.
+    static void parse_chunk(std::string_view chunk, std::size_t index, Completion& completion) {
+        try {
+            std::vector<Json> records;
+            parse(chunk, records);
+            completion.finish(index, std::move(records));
+        } catch (...) {
+            completion.fail(index, std::current_exception());
+        }
+    }
+
+public:
+    /// \brief Split \param text into chunks of about \param chunk_size bytes that end at line ends.
+    static std::vector<std::string_view> split(std::string_view text, std::size_t chunk_size);
+
+    /// \brief Parse the lines of \param chunk, the records are appended to \param records.
+    static void parse(std::string_view chunk, std::vector<Json>& records);
+
+    /// \brief Parse the lines of \param text on \param pool and call \param callback with every record.
+    /// The callback is called on the calling thread with a Json rvalue. A few chunks
+    /// per worker are parsed ahead of the delivery, so records are not all kept in memory.
+    /// Chunks no worker started by the time they are needed are parsed on the calling
+    /// thread, so neither a stopped pool (gracefully or not) nor ThreadPool<0> blocks
+    /// the read; jobs left in the queue find their chunk claimed and do nothing.
+    /// \returns the number of records.
+    template<unsigned N, class Callback>
+    static std::size_t read(std::string_view text, ThreadPool<N>& pool, Callback callback, Options options = {}) {
+        const auto chunks = split(text, options.chunk_size);
+        const auto completion = std::make_shared<Completion>(chunks.size());
+        const auto window = 2 * static_cast<std::size_t>(N > 0 ? N : 1);
+
+        std::size_t submitted = 0;
+        const auto submit = [&]() {
+            const auto index = submitted++;
+            pool.add_job([completion, chunk = chunks[index], index]() {
+                if (completion->claim(index))
+                    parse_chunk(chunk, index, *completion);
+            });
+        };
+
+        // The reader parses the next chunk no worker started instead of waiting for it
+        std::size_t unclaimed = 0;
+        const auto help = [&](std::size_t chunk) {
+            unclaimed = std::max(unclaimed, chunk);
+            while (unclaimed < submitted && !completion->claim(unclaimed))
+                ++unclaimed;
+            if (unclaimed < submitted)
+                parse_chunk(chunks[unclaimed], unclaimed, *completion);
+        };
+
+        std::size_t records = 0;
+        try {
+            for (std::size_t delivered = 0; delivered < chunks.size(); ++delivered) {
+                while (submitted < chunks.size() && submitted < delivered + window)
+                    submit();
+
+                const auto ordered = options.order == Order::Ordered;
+                help(ordered ? delivered : unclaimed);
+                auto parsed = ordered ? completion->take(delivered) : completion->take_any();
+                records += parsed.size();
+                for (auto& record : parsed)
+                    callback(std::move(record));
+            }
+        } catch (...) {
+            // The jobs that started refer to the text
+            completion->cancel(submitted);
+            completion->wait(submitted);
+            throw;
+        }
+        return records;
+    }
+
+    /// \brief Parse the lines of the file at \param path, memory mapped.
+    /// \see JsonLines::read
+    /// \returns the number of records, std::nullopt if the file can not be read.
+    template<unsigned N, class Callback>
+    static std::optional<std::size_t> read_file(const std::string& path, ThreadPool<N>& pool, Callback callback,
+                                                Options options = {}) {
+        const MappedFile file(path);
+        if (!file)
+            return std::nullopt;
+        return read(file.view(), pool, std::move(callback), options);
+    }
+};
+
+/// \brief Writer of JSON Lines (NDJSON).
+/// Records are serialized minified into a buffer, which is written to the stream
+/// in one call whenever it grows over the batch size, and when the writer is destroyed.
+class JsonLinesWriter {
+private:
+    std::ostream& _stream;
+    JsonWriter _writer;
+
+    /// \brief Size of the buffer that triggers a write to the stream.
+    std::size_t _batch_size;
+
+public:
+    explicit JsonLinesWriter(std::ostream& stream, std::size_t batch_size = 1 << 16)
+        : _stream(stream), _batch_size(batch_size) {}
+
+    JsonLinesWriter(const JsonLinesWriter&) = delete;
+    JsonLinesWriter& operator=(const JsonLinesWriter&) = delete;
+
+    ~JsonLinesWriter() {
+        flush();
+    }
+
+    /// \brief Append \param json as a line.
+    JsonLinesWriter& write(const Json& json);
+
+    /// \brief Write the buffered lines to the stream.
+    void flush();
+};
+
+}
+
+#endif //CORE_JSONLINES_HPP
@@ -0,0 +1,112 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONPARALLELPARSER_HPP
+#define CORE_JSONPARALLELPARSER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <Json/Json.hpp>
+#include <ThreadPool/ThreadPool.hpp>
+
+namespace Core {
+
+/// \brief Parser of documents that are one large array, the elements are parsed in parallel.
+/// A fast scan over the text, aware of strings and escapes, finds the commas that
+/// separate the elements of the top-level array. The elements are grouped into
+/// chunks that are parsed on a ThreadPool, each straight into its place in the
+/// resulting array, so nothing is moved when the chunks are assembled.
+/// Other documents are parsed by Json::parse on the calling thread.
+class JsonParallelParser {
+public:
+    /// \brief Consecutive elements of the top-level array.
+    struct Chunk {
+        /// \brief The comma separated elements.
+        std::string_view text;
+
+        /// \brief Index of the first element in the array.
+        std::size_t first;
+
+        /// \brief Number of elements.
+        std::size_t count;
+    };
+
+    /// \brief Top-level elements of a document.
+    struct Split {
+        std::vector<Chunk> chunks;
+
+        /// \brief Number of elements in all chunks.
+        std::size_t size = 0;
+    };
+
+private:
+    /// \brief Parse the elements of \param chunk into \param values.
+    static bool parse_chunk(const Chunk& chunk, Json::Value* values) {
+        return Json::parse_values(chunk.text, values, chunk.count, 1);
+    }
+
+public:
+    /// \brief Split the elements of the top-level array of \param text into chunks of about \param chunk_size bytes.
+    /// Only strings and the nesting of brackets are followed, the chunks are validated when parsed.
+    /// \returns std::nullopt if the document is not an array or its end is not found.
+    static std::optional<Split> split(std::string_view text, std::size_t chunk_size);
+
+    /// \brief Parse \param text, the elements of a top-level array are parsed in chunks on \param pool.
+    /// The result is the same as that of Json::parse. The calling thread parses the
+    /// chunks no worker started, so neither a stopped pool (gracefully or not) nor
+    /// ThreadPool<0> blocks the parse; jobs left in the queue find their chunk
+    /// claimed and do nothing.
+    template<unsigned N>
+    static Json parse(std::string_view text, ThreadPool<N>& pool, std::size_t chunk_size = 1 << 16) {
+        const auto split_text = split(text, chunk_size);
+        if (!split_text)
+            return Json::parse(text);
+
+        const auto& chunks = split_text->chunks;
+        Json::JsonArray array(split_text->size);
+
+        // A chunk is parsed by whoever claims it first, a job or the calling thread
+        const auto claimed = std::make_shared<std::vector<std::atomic<bool>>>(chunks.size());
+        std::vector<std::future<bool>> parsed;
+        parsed.reserve(chunks.size());
+        for (std::size_t index = 0; index < chunks.size(); ++index) {
+            auto* values = array.data() + chunks[index].first;
+            parsed.push_back(pool.add_job([claimed, index, chunk = chunks[index], values]() {
+                return (*claimed)[index].exchange(true) || parse_chunk(chunk, values);
+            }));
+        }
+
+        bool valid = true;
+        std::vector<std::size_t> started;
+        for (std::size_t index = 0; index < chunks.size(); ++index) {
+            if (!(*claimed)[index].exchange(true))
+                valid = parse_chunk(chunks[index], array.data() + chunks[index].first) && valid;
+            else
+                started.push_back(index);
+        }
+
+        // The jobs that started write into the array, it can not be released before they are done
+        for (const auto index : started)
+            parsed[index].wait();
+        for (const auto index : started)
+            valid = parsed[index].get() && valid;
+
+        if (!valid) {
+            auto json = Json::create_object();
+            json._valid = false;
+            return json;
+        }
+        return Json(std::move(array));
+    }
+};
+
+}
+
+#endif //CORE_JSONPARALLELPARSER_HPP
@@ -0,0 +1,119 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONPATCH_HPP
+#define CORE_JSONPATCH_HPP
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Json/Json.hpp>
+
+namespace Core {
+
+/// \brief JSON Patch (RFC 6902) and JSON Merge Patch (RFC 7386).
+/// Patches are applied in place: only the containers on the paths of the
+/// operations are visited, untouched subtrees are neither copied nor moved.
+/// Values are compared as JSON does, numbers by their value (1 equals 1.0).
+class JsonPatch {
+    friend class JsonSchema;
+public:
+    /// \brief Reference tokens of a JSON Pointer (RFC 6901), shared with JsonSchema.
+    using Pointer = std::vector<std::string>;
+
+    /// \brief Split a JSON Pointer into its reference tokens, ~1 and ~0 decoded.
+    /// \returns std::nullopt if the pointer does not start with '/' and is not empty.
+    static std::optional<Pointer> parse_pointer(std::string_view pointer);
+
+    /// \brief Append \param token to the JSON Pointer \param pointer, '~' and '/' escaped.
+    static std::string append_token(const std::string& pointer, std::string_view token);
+
+private:
+    /// \brief Index of an array element in \param token, \param size for "-" if \param allow_end.
+    static std::optional<std::size_t> parse_index(const std::string& token, std::size_t size, bool allow_end);
+
+    /// \brief The member or element \param token of \param container, nullptr if missing.
+    static Json::Value* child(Json& container, const std::string& token);
+
+    /// \brief The container the last token of \param pointer refers into, nullptr if missing.
+    static Json* parent(Json& document, const Pointer& pointer);
+
+    /// \brief The value at \param pointer (not the document itself), nullptr if missing.
+    static Json::Value* find(Json& document, const Pointer& pointer);
+
+    /// \brief Step reverting an applied operation, \see JsonPatch::apply.
+    /// Steps are reverted in reverse order, a value taken out by Remove or Replace
+    /// is carried to the next step, an Add without a value of its own puts it back.
+    struct Undo {
+        enum class Kind {
+            Add,
+            Remove,
+            Replace
+        };
+
+        Kind kind;
+
+        /// \brief Where to revert, array indexes resolved ("-" is never used).
+        Pointer pointer;
+
+        /// \brief The value removed or replaced by the operation.
+        std::optional<Json::Value> value;
+    };
+
+    using UndoLog = std::vector<Undo>;
+
+    /// \brief Operations at \param pointer, \param value is only moved from if they succeed.
+    /// On success the step reverting them is appended to \param undo if given.
+    static bool add(Json& document, const Pointer& pointer, Json::Value&& value, UndoLog* undo = nullptr);
+    static std::optional<Json::Value> remove(Json& document, const Pointer& pointer);
+    static bool replace(Json& document, const Pointer& pointer, Json::Value&& value, UndoLog& undo);
+
+    /// \brief Apply the operation \param operation, appending the steps reverting it to \param undo.
+    static bool apply_operation(Json& document, const Json::Value& operation, UndoLog& undo);
+
+    /// \brief Revert the operations recorded in \param undo, last first.
+    static void rollback(Json& document, UndoLog& undo);
+
+    /// \brief Equality of JSON values, numbers compared by value.
+    static bool equal(const Json::Value& first, const Json::Value& second);
+    static bool equal(const Json& first, const Json& second);
+
+    /// \brief Append the operations turning \param from into \param to at \param path to \param patch.
+    static void diff(const Json& from, const Json& to, const std::string& path, Json& patch);
+
+    static void merge(Json::Value& target, const Json::Value& patch);
+    static Json merge_diff_object(const Json& from, const Json& to);
+
+public:
+    /// \brief Apply the operations of the JSON Patch \param patch to \param document.
+    /// Operations are applied in order, add, remove, replace, move, copy and test
+    /// are supported. The whole document can be replaced by a container only.
+    /// The patch is atomic (RFC 6902 section 5): if an operation fails, the ones
+    /// before it are reverted from an undo log holding the values they removed or
+    /// replaced, nothing is copied up front. Restored object members are appended
+    /// to their object, equal to the original but not necessarily in its order.
+    /// \returns false if the patch is malformed or an operation fails.
+    static bool apply(Json& document, const Json& patch);
+
+    /// \brief JSON Patch turning \param from into \param to.
+    /// Objects are compared member by member and arrays element by element, so the
+    /// patch is proportional to the changes (insertions into arrays excepted).
+    static Json diff(const Json& from, const Json& to);
+
+    /// \brief Apply the JSON Merge Patch \param patch to \param target.
+    /// Members of the patch set to null are removed, objects are merged recursively,
+    /// anything else is replaced.
+    static void merge(Json& target, const Json& patch);
+
+    /// \brief JSON Merge Patch turning \param from into \param to.
+    /// Merge patches can not express members set to null or changes inside arrays,
+    /// changed arrays are contained whole.
+    static Json merge_diff(const Json& from, const Json& to);
+};
+
+}
+
+#endif //CORE_JSONPATCH_HPP
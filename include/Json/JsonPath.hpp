@@ -0,0 +1,227 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONPATH_HPP
+#define CORE_JSONPATH_HPP
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Core {
+
+/// \brief Exception that is thrown in case bad path is provided when dealing with JSONs.
+class bad_json_path : public std::exception {
+private:
+    std::string _message;
+public:
+    bad_json_path(std::string message) : _message(std::move(message)) {}
+    const char * what() const noexcept {
+        return _message.c_str();
+    }
+};
+
+/// \brief Path in a JSON document, parsed once and looked up any number of times.
+/// Accepted path structure: <objectKey>[<arrayIndex>].<objectKey2>[<arrayIndex2>]...
+/// Brackets not holding an index are part of the key, '[', ']', '.' and '\' can be
+/// escaped with '\'. The path refers to the text it was constructed from, the
+/// text has to outlive it (temporary strings are rejected). Paths looked up
+/// repeatedly are compiled once:
+/// \code
+/// static const JsonPath path("acquaintances[0].name");
+/// auto name = json.get<std::string>(path);
+/// \endcode
+/// The segments of short paths are stored inline, longer paths are moved to the heap.
+class JsonPath {
+public:
+    /// \brief Number of keys and indexes stored without allocation.
+    static constexpr std::size_t inline_segments = 8;
+
+    /// \brief A key or an index of the path.
+    class Segment {
+    private:
+        friend class JsonPath;
+
+        /// \brief Text of the key, escape sequences kept.
+        std::string_view _key{};
+        std::size_t _index = 0;
+        bool _is_index = false;
+        bool _escaped = false;
+
+        /// \brief Check if \param c may be escaped.
+        static constexpr bool escapable(char c) {
+            return c == '[' || c == ']' || c == '.' || c == '\\';
+        }
+
+    public:
+        constexpr bool is_index() const {
+            return _is_index;
+        }
+
+        constexpr std::size_t index() const {
+            return _index;
+        }
+
+        /// \brief Check if the key has escape sequences.
+        constexpr bool escaped() const {
+            return _escaped;
+        }
+
+        /// \brief The key as written in the path, escape sequences kept.
+        constexpr std::string_view raw_key() const {
+            return _key;
+        }
+
+        /// \brief The key before its first escape sequence, i.e. a prefix of every matching key.
+        constexpr std::string_view key_prefix() const {
+            return _escaped ? _key.substr(0, _key.find('\\')) : _key;
+        }
+
+        /// \brief Check if the segment is the key \param key.
+        constexpr bool matches(std::string_view key) const {
+            if (_is_index)
+                return false;
+            if (!_escaped)
+                return _key == key;
+
+            std::size_t matched = 0;
+            for (std::size_t i = 0; i < _key.size(); ++i, ++matched) {
+                if (_key[i] == '\\' && i + 1 < _key.size() && escapable(_key[i + 1]))
+                    ++i;
+                if (matched == key.size() || key[matched] != _key[i])
+                    return false;
+            }
+            return matched == key.size();
+        }
+
+        /// \brief The key, escape sequences removed.
+        std::string key() const {
+            std::string key;
+            for (std::size_t i = 0; i < _key.size(); ++i) {
+                if (_key[i] == '\\' && i + 1 < _key.size() && escapable(_key[i + 1]))
+                    ++i;
+                key += _key[i];
+            }
+            return key;
+        }
+    };
+
+private:
+    std::array<Segment, inline_segments> _inline{};
+
+    /// \brief All the segments once there are more than inline_segments.
+    std::vector<Segment> _overflow;
+
+    std::size_t _size = 0;
+
+    /// \brief Add a key, empty keys are skipped.
+    void push_key(std::string_view key, bool escaped) {
+        if (key.empty())
+            return;
+        auto& segment = push();
+        segment._key = key;
+        segment._escaped = escaped;
+    }
+
+    Segment& push() {
+        if (_size < inline_segments)
+            return _inline[_size++];
+        if (_size++ == inline_segments)
+            _overflow.assign(_inline.begin(), _inline.end());
+        return _overflow.emplace_back();
+    }
+
+    /// \brief Position after the indexes starting at \param position, npos if the
+    /// brackets there are not indexes (i.e. part of a key).
+    static std::size_t indexes_end(std::string_view path, std::size_t position) {
+        while (position < path.size() && path[position] == '[') {
+            auto digit = position + 1;
+            while (digit < path.size() && path[digit] >= '0' && path[digit] <= '9')
+                ++digit;
+            if (digit == position + 1 || digit == path.size() || path[digit] != ']')
+                return std::string_view::npos;
+            position = digit + 1;
+        }
+        return position == path.size() || path[position] == '.' ? position : std::string_view::npos;
+    }
+
+    /// \brief Add the indexes of [begin, end).
+    void push_indexes(std::string_view path, std::size_t begin, std::size_t end) {
+        for (auto position = begin + 1; position < end; ++position) {
+            auto& segment = push();
+            segment._is_index = true;
+            for (; path[position] != ']'; ++position) {
+                segment._index = segment._index * 10 + static_cast<std::size_t>(path[position] - '0');
+                if (segment._index > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+                    throw bad_json_path("Index is out of range");
+            }
+            ++position;
+        }
+    }
+
+public:
+    /// \brief Parse \param path.
+    /// \throws bad_json_path if a bracket is not closed or an index does not fit int
+    explicit JsonPath(std::string_view path) {
+        std::size_t key_begin = 0;
+        bool escaped = false;
+        for (std::size_t position = 0; position < path.size();) {
+            const auto c = path[position];
+            if (c == '\\' && position + 1 < path.size() && Segment::escapable(path[position + 1])) {
+                escaped = true;
+                position += 2;
+            } else if (c == '.') {
+                push_key(path.substr(key_begin, position - key_begin), escaped);
+                key_begin = ++position;
+                escaped = false;
+            } else if (const auto end = c == '[' ? indexes_end(path, position) : std::string_view::npos;
+                       end != std::string_view::npos) {
+                push_key(path.substr(key_begin, position - key_begin), escaped);
+                push_indexes(path, position, end);
+                key_begin = position = end;
+                escaped = false;
+            } else if (c == '[' && path.find(']', position) == std::string_view::npos) {
+                throw bad_json_path("Unclosed bracket in path");
+            } else {
+                ++position;
+            }
+        }
+        push_key(path.substr(key_begin), escaped);
+    }
+
+    /// \brief Parse the string literal \param path.
+    explicit JsonPath(const char* path) : JsonPath(std::string_view(path)) {}
+
+    /// \brief The segments would refer to the destroyed string.
+    explicit JsonPath(std::string&&) = delete;
+
+    /// \brief Number of keys and indexes.
+    std::size_t size() const {
+        return _size;
+    }
+
+    bool empty() const {
+        return _size == 0;
+    }
+
+    const Segment& operator[](std::size_t i) const {
+        return begin()[i];
+    }
+
+    const Segment* begin() const {
+        return _size > inline_segments ? _overflow.data() : _inline.data();
+    }
+
+    const Segment* end() const {
+        return begin() + _size;
+    }
+};
+
+}
+
+#endif //CORE_JSONPATH_HPP
@@ -0,0 +1,78 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONPATTERN_HPP
+#define CORE_JSONPATTERN_HPP
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Core {
+
+/// \brief Regular expression of the JSON Schema pattern keywords (ECMAScript syntax).
+/// Patterns are compiled into a program run by a Pike VM: every state the pattern
+/// can be in advances in step over the input, which is read once. Matching takes
+/// time linear in the input and no recursion, whatever the pattern is.
+/// Supported: literals and escapes, '.', classes, \\d \\w \\s and their negations,
+/// ^ $ \\b \\B, groups, alternation and the greedy and lazy quantifiers.
+/// Characters are bytes, as they are for std::regex.
+/// Backreferences and lookarounds need backtracking, which can take exponential
+/// time and recurses per character of the input: patterns using them are refused.
+class JsonPattern {
+    struct Instruction {
+        enum class Op : std::uint8_t {
+            Byte,
+            Class,
+            Split,
+            Jump,
+            Begin,
+            End,
+            WordBoundary,
+            NotWordBoundary,
+            Match
+        };
+
+        Op op;
+
+        /// \brief The byte of Byte.
+        unsigned char byte = 0;
+
+        /// \brief The class of Class, the targets of Jump and Split.
+        std::uint32_t first = 0, second = 0;
+    };
+
+    struct Node;
+    class Parser;
+
+    std::vector<Instruction> _program;
+    std::vector<std::bitset<256>> _classes;
+
+    JsonPattern() = default;
+
+    /// \brief Append the instructions of \param node to the program.
+    void emit(const Node& node);
+
+    /// \brief Add the thread at \param pc and the ones it reaches without
+    /// reading to \param threads, at \param position of \param text.
+    /// \returns true if the pattern matched.
+    bool follow(std::vector<std::uint32_t>& threads, std::uint32_t pc, std::string_view text, std::size_t position,
+                std::vector<std::size_t>& visited, std::vector<std::uint32_t>& stack) const;
+
+public:
+    /// \brief Compile \param pattern.
+    /// \returns std::nullopt if the pattern is malformed, needs backtracking or
+    /// repeats more than 1000 times, or if its program is too large.
+    static std::optional<JsonPattern> compile(std::string_view pattern);
+
+    /// \brief Check if the pattern matches anywhere in \param text.
+    bool search(std::string_view text) const;
+};
+
+}
+
+#endif //CORE_JSONPATTERN_HPP
@@ -0,0 +1,106 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONPUSHPARSER_HPP
+#define CORE_JSONPUSHPARSER_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <Json/Json.hpp>
+#include <Json/JsonBuilder.hpp>
+#include <Json/JsonSaxParser.hpp>
+
+namespace Core {
+
+/// \brief Resumable parser of documents arriving in chunks (e.g. from pipes and sockets).
+/// Chunks are fed as they arrive, split at any byte. The parse state is kept
+/// between the calls, so no byte is scanned twice, and the document is built
+/// as it is parsed. A stream may carry several documents one after the other:
+/// feeding stops at the end of each, see JsonPushParser::consumed.
+/// \code
+/// JsonPushParser parser;
+/// while (auto chunk = receive()) {
+///     std::string_view rest = *chunk;
+///     while (!rest.empty()) {
+///         auto status = parser.feed(rest);
+///         rest.remove_prefix(parser.consumed());
+///         if (status == JsonPushParser::Status::Complete)
+///             handle(*parser.take());
+///         else if (status == JsonPushParser::Status::Error)
+///             return;
+///     }
+/// }
+/// \endcode
+class JsonPushParser {
+public:
+    /// \brief Result of JsonPushParser::feed.
+    enum class Status {
+        NeedsMore,  ///< The chunk is consumed, the document is not complete yet.
+        Complete,   ///< A document is complete, \see JsonPushParser::take.
+        Error       ///< The text is invalid, \see JsonPushParser::offset.
+    };
+
+private:
+    /// \brief Builds the document, stops the parser at its end.
+    JsonBuilder _builder{true};
+
+    /// \brief Parses the text of the current document.
+    JsonSaxParser _parser{_builder};
+
+    /// \brief The last status returned.
+    Status _status = Status::NeedsMore;
+
+    /// \brief Bytes of the last chunk that were consumed.
+    std::size_t _consumed = 0;
+
+    /// \brief Bytes consumed by the documents before the current one.
+    std::size_t _offset = 0;
+
+    /// \brief The last completed document until it is taken.
+    std::optional<Json> _document;
+
+public:
+    /// \brief Construct a parser waiting for the first document.
+    JsonPushParser() = default;
+
+    /// \brief Disabled copy constructor, the parser refers to the builder.
+    JsonPushParser(const JsonPushParser&) = delete;
+
+    /// \brief Disabled copy-assignment operator.
+    JsonPushParser& operator=(const JsonPushParser&) = delete;
+
+    /// \brief Parse the next chunk.
+    /// Parsing stops at the end of a document, the rest of the chunk is to be
+    /// fed again (after taking the document). A completed document that is not
+    /// taken is dropped by the next call.
+    /// After an error, the parser has to be reset.
+    Status feed(std::string_view chunk);
+
+    /// \brief Number of bytes of the last chunk that were consumed.
+    std::size_t consumed() const {
+        return _consumed;
+    }
+
+    /// \brief Number of bytes consumed since construction or reset, or the
+    /// offset of the invalid byte after an error.
+    std::size_t offset() const;
+
+    /// \brief Check if a document is partially parsed, i.e. the input can not end here.
+    bool pending() const {
+        return _status == Status::NeedsMore && !_parser.idle();
+    }
+
+    /// \brief Take the completed document.
+    /// \returns std::nullopt if no document is complete.
+    std::optional<Json> take();
+
+    /// \brief Drop the state, start over with a new stream.
+    void reset();
+};
+
+}
+
+#endif //CORE_JSONPUSHPARSER_HPP
@@ -0,0 +1,171 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONSAXPARSER_HPP
+#define CORE_JSONSAXPARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Json/IJsonHandler.hpp>
+
+namespace Core {
+
+/// \brief Event driven (SAX) JSON parser reading its input in chunks.
+/// The text can be split at any byte, the state of the parse is kept between
+/// the chunks, so no byte is read twice and nothing but the token being read
+/// (a string or a number crossing the chunk boundary) and the stack of open
+/// containers is held in memory. No document model is built, the handler
+/// receives the events as the text is read.
+/// Accepts the same documents as Json::Json(const std::string&): an object or
+/// an array, optionally surrounded by whitespace.
+class JsonSaxParser {
+public:
+    /// \brief Maximum nesting depth of objects and arrays.
+    static constexpr std::size_t max_depth = 1024;
+
+private:
+    /// \brief What the parser expects next.
+    enum class State : std::uint8_t {
+        Start,            ///< Whitespace, then the opening of the document.
+        FirstKey,         ///< Key of the first member or the end of the object.
+        Key,              ///< Key of the next member.
+        Colon,            ///< Colon after the key.
+        FirstValue,       ///< First element or the end of the array.
+        Value,            ///< Value of a member or element.
+        Separator,        ///< Comma or the end of the innermost container.
+        String,           ///< Inside a key or a string value.
+        Number,           ///< Inside a number.
+        Literal,          ///< Inside true, false or null.
+        Done,             ///< The document is complete, only whitespace may follow.
+        Failed,           ///< The text is not valid JSON.
+        Stopped           ///< The handler stopped the parser.
+    };
+
+    /// \brief Position inside a string.
+    enum class StringState : std::uint8_t {
+        Plain,
+        Escape,
+        Unicode
+    };
+
+    /// \brief Position inside a number, \see JsonCursor::read_number.
+    enum class NumberState : std::uint8_t {
+        Sign,
+        Zero,
+        Integer,
+        Point,
+        Fraction,
+        Exponent,
+        ExponentSign,
+        ExponentDigits
+    };
+
+    /// \brief Receiver of the events.
+    IJsonHandler &_handler;
+
+    State _state = State::Start;
+
+    /// \brief Open containers, '{' or '['.
+    std::vector<char> _containers;
+
+    /// \brief Whether the string being read is a key.
+    bool _is_key = false;
+
+    StringState _string_state = StringState::Plain;
+
+    /// \brief Hex digits still expected in a \\u escape.
+    unsigned _unicode_remaining = 0;
+
+    /// \brief Whether the string being read has escape sequences.
+    bool _string_escaped = false;
+
+    /// \brief The last string with escape sequences, decoded.
+    std::string _unescaped;
+
+    NumberState _number_state = NumberState::Sign;
+
+    /// \brief The literal being matched and the number of characters matched so far.
+    std::string_view _literal;
+    std::size_t _literal_matched = 0;
+
+    /// \brief Beginning of the token being read in the current chunk.
+    std::size_t _token_begin = 0;
+
+    /// \brief The part of the token read from previous chunks.
+    std::string _token;
+
+    /// \brief Whether the token being read started in a previous chunk.
+    bool _token_continued = false;
+
+    /// \brief Bytes of the previous chunks.
+    std::size_t _offset = 0;
+
+    /// \brief Offset of the byte the parser failed or stopped at.
+    std::size_t _error_offset = 0;
+
+    /// \brief Internal helpers of JsonSaxParser::feed, they return false if the parse can not go on.
+    bool fail(std::size_t position);
+    bool stop(bool proceed, std::size_t position);
+    bool open(char container, std::size_t position);
+    bool close(char bracket, std::size_t position);
+    bool begin_value(char character, std::size_t position);
+    bool end_value();
+    std::string_view token(std::string_view chunk, std::size_t end);
+    bool read_string(std::string_view chunk, std::size_t &position);
+    bool read_number(std::string_view chunk, std::size_t &position);
+    bool read_literal(std::string_view chunk, std::size_t &position);
+
+public:
+    /// \brief Construct a parser reporting to \param handler.
+    explicit JsonSaxParser(IJsonHandler &handler) : _handler(handler) {}
+
+    /// \brief Parse the next chunk of the text.
+    /// \returns false if the text is invalid or the handler stopped the parser.
+    bool feed(std::string_view chunk);
+
+    /// \brief Signal the end of the text.
+    /// \returns true if a complete document was parsed.
+    bool finish();
+
+    /// \brief Start over with a new document.
+    void reset();
+
+    /// \brief Check if nothing but whitespace was read since construction or reset.
+    bool idle() const {
+        return _state == State::Start;
+    }
+
+    /// \brief Check if a complete document was parsed.
+    bool complete() const {
+        return _state == State::Done;
+    }
+
+    /// \brief Check if the text was found to be invalid.
+    bool failed() const {
+        return _state == State::Failed;
+    }
+
+    /// \brief Check if the handler stopped the parser.
+    bool stopped() const {
+        return _state == State::Stopped;
+    }
+
+    /// \brief Number of bytes processed, or the offset of the byte the parser failed or stopped at.
+    std::size_t offset() const {
+        return failed() || stopped() ? _error_offset : _offset;
+    }
+
+    /// \brief Parse the text read from \param stream in chunks of \param chunk_size bytes.
+    /// \returns true if a complete document was parsed.
+    static bool parse(std::istream &stream, IJsonHandler &handler, std::size_t chunk_size = 64 * 1024);
+};
+
+}
+
+#endif //CORE_JSONSAXPARSER_HPP
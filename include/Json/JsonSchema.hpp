@@ -0,0 +1,174 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONSCHEMA_HPP
+#define CORE_JSONSCHEMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <Json/Json.hpp>
+#include <Json/JsonPattern.hpp>
+
+namespace Core {
+
+class JsonCursor;
+
+/// \brief Validator of JSON Schema (draft 7), compiled once and run over many documents.
+/// The schema is compiled into a flat program of nodes, one per subschema, that
+/// refer to each other by index; "$ref" to the schema itself ("#", "#/definitions/x")
+/// resolves to the node of the target, so recursive schemas are supported.
+/// Supported keywords: type, enum, const, the numeric and string bounds, pattern,
+/// items, additionalItems, contains, uniqueItems, properties, patternProperties,
+/// additionalProperties, required, dependencies, propertyNames, min/maxProperties,
+/// allOf, anyOf, oneOf, not, if/then/else and definitions. "format" is an annotation
+/// and is not checked, other unknown keywords are ignored.
+/// Patterns are matched in linear time, \see JsonPattern; a schema whose patterns
+/// need backtracking (backreferences, lookarounds) is invalid.
+/// Validation stops at the first error.
+class JsonSchema {
+public:
+    /// \brief The first violation found.
+    struct Error {
+        /// \brief JSON Pointer to the offending value.
+        std::string path;
+
+        std::string message;
+    };
+
+private:
+    enum Type : std::uint8_t {
+        Null = 1 << 0,
+        Boolean = 1 << 1,
+        Integer = 1 << 2,
+        Number = 1 << 3,
+        String = 1 << 4,
+        Object = 1 << 5,
+        Array = 1 << 6,
+        Any = 0x7F
+    };
+
+    struct Property {
+        std::string name;
+
+        /// \brief Node of the "properties" entry, if any.
+        std::optional<std::size_t> schema;
+
+        /// \brief Bit of the "required" entry in the mask of seen members, if any.
+        std::optional<std::size_t> required;
+    };
+
+    /// \brief Compiled subschema.
+    struct Node {
+        /// \brief Mask of the accepted Type values, 0 for the false schema.
+        std::uint8_t types = Any;
+
+        std::optional<std::vector<Json::Value>> enum_values;
+
+        std::optional<double> minimum, maximum, exclusive_minimum, exclusive_maximum, multiple_of;
+
+        std::optional<std::size_t> min_length, max_length;
+        std::optional<JsonPattern> pattern;
+
+        std::optional<std::size_t> items;
+        std::vector<std::size_t> tuple_items;
+        std::optional<std::size_t> additional_items, contains;
+        std::optional<std::size_t> min_items, max_items;
+        bool unique_items = false;
+
+        /// \brief Members of "properties" and "required", sorted by name.
+        std::vector<Property> properties;
+        std::size_t required_count = 0;
+        std::vector<std::pair<JsonPattern, std::size_t>> pattern_properties;
+        std::optional<std::size_t> additional_properties, property_names;
+        std::optional<std::size_t> min_properties, max_properties;
+        std::vector<std::pair<std::string, std::vector<std::string>>> dependent_required;
+        std::vector<std::pair<std::string, std::size_t>> dependent_schemas;
+
+        std::vector<std::size_t> all_of, any_of, one_of;
+        std::optional<std::size_t> not_schema, if_schema, then_schema, else_schema;
+
+        /// \brief Whether the node can be checked while the text is read, without building the value.
+        bool streamable = true;
+    };
+
+    /// \brief Nodes of the true and the false schema.
+    static constexpr std::size_t accept_all = 0;
+    static constexpr std::size_t reject_all = 1;
+
+    std::vector<Node> _nodes;
+    std::size_t _root = accept_all;
+    bool _valid = false;
+
+    /// \brief Compilation state, only used while the schema is compiled.
+    struct Compiler {
+        const Json& root;
+
+        /// \brief Nodes of the compiled JSON Pointers, for "$ref".
+        std::map<std::string, std::size_t> compiled;
+    };
+
+    /// \brief Keyword values: a number, a non-negative integer and an ECMAScript regular expression.
+    static std::optional<double> number(const Json::Value& value);
+    static std::optional<std::size_t> count(const Json::Value& value);
+    static std::optional<JsonPattern> regex(const Json::Value& value);
+
+    /// \brief Compile the subschema \param schema found at \param pointer.
+    /// \returns the index of its node, std::nullopt if the schema is malformed.
+    std::optional<std::size_t> compile(Compiler& compiler, const Json::Value& schema, const std::string& pointer);
+    std::optional<std::size_t> compile_object(Compiler& compiler, const Json& schema, const std::string& pointer);
+
+    /// \brief Compile the target of the "$ref" \param reference.
+    std::optional<std::size_t> compile_reference(Compiler& compiler, const std::string& reference);
+
+    /// \brief Equality of JSON values, \see JsonPatch::equal.
+    static bool equal(const Json::Value& first, const Json::Value& second);
+    static bool equal(const Json::Value& first, const Json& second);
+
+    /// \brief Validation of the built values.
+    bool validate_value(std::size_t node, const Json::Value& value, Error* error) const;
+    bool validate_json(std::size_t node, const Json& json, Error* error) const;
+    bool validate_number(const Node& node, double value, bool integer, Error* error) const;
+    bool validate_string(const Node& node, std::string_view value, Error* error) const;
+
+    /// \brief Checks shared by every type: enum and the combinators.
+    template<class Value>
+    bool validate_common(const Node& node, const Value& value, Error* error) const;
+
+    /// \brief Validate the value at \param cursor while it is read, nested \param depth deep.
+    bool validate_text(std::size_t node, JsonCursor& cursor, std::size_t depth, Error* error) const;
+
+public:
+    /// \brief Compile \param schema, \see JsonSchema::valid.
+    explicit JsonSchema(const Json& schema);
+
+    /// \brief Whether the schema was compiled, it is not if it is malformed
+    /// or refers to something other than itself.
+    bool valid() const {
+        return _valid;
+    }
+
+    explicit operator bool() const {
+        return valid();
+    }
+
+    /// \brief Validate \param document, the first violation is stored in \param error.
+    bool validate(const Json& document, Error* error = nullptr) const;
+
+    /// \brief Validate the JSON text \param text while it is parsed, without building a Json.
+    /// Only subschemas that need the whole value (enum, const, uniqueItems, contains,
+    /// patternProperties, dependencies, propertyNames and the combinators) have the
+    /// value built for them. Text that is not a JSON document fails the validation.
+    bool validate_text(std::string_view text, Error* error = nullptr) const;
+};
+
+}
+
+#endif //CORE_JSONSCHEMA_HPP
@@ -0,0 +1,149 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONSTRUCTURALINDEX_HPP
+#define CORE_JSONSTRUCTURALINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Core {
+
+/// \brief Structural index of JSON text (stage 1 of the two-stage parser).
+/// The text is classified in 64 byte blocks into bitmasks of quotes, backslashes,
+/// structural characters and whitespace (with AVX2 or SSE4.2 when the CPU
+/// supports it, scalar code otherwise), from which the positions of every
+/// structural character, string and scalar outside of strings are extracted.
+/// Stage 2 (\see Json::Json(const JsonStructuralIndex&)) walks the index token by
+/// token instead of scanning the text and yields exactly the same result as the
+/// scalar parser.
+/// The index refers to the text, which must outlive it.
+class JsonStructuralIndex {
+public:
+    /// \brief Instruction set used to classify the blocks.
+    enum class Implementation {
+        Scalar,
+        SSE42,
+        AVX2
+    };
+
+    /// \brief Cursor walking the tokens of the index, the stage 2 counterpart of JsonCursor.
+    /// Every token starts at an entry of the index: the next character is the one
+    /// at the next entry, whitespace is never looked at. Strings end at the next
+    /// closing quote of the index and are copied in bulk unless they hold escapes,
+    /// numbers and literals end where the next entry starts.
+    class Cursor {
+    private:
+        /// \brief The index being walked.
+        const JsonStructuralIndex& _index;
+
+        /// \brief Next entry of JsonStructuralIndex::_structurals.
+        std::size_t _next = 0;
+
+        /// \brief Next entry of JsonStructuralIndex::_string_ends, strings are read in order.
+        std::size_t _next_string = 0;
+
+        /// \brief The number or literal of the next entry, trailing whitespace excluded.
+        std::string_view scalar() const;
+
+    public:
+        /// \brief Construct a cursor at the first token of \param index.
+        explicit Cursor(const JsonStructuralIndex& index) : _index(index) {}
+
+        /// \brief Check if every token is consumed.
+        bool at_end() const {
+            return _next >= _index._structurals.size();
+        }
+
+        /// \brief Whitespace is not indexed, there is nothing to skip.
+        void skip_whitespace() {}
+
+        /// \brief First character of the next token without consuming it.
+        /// \returns '\0' at the end of the input.
+        char peek() const {
+            return at_end() ? '\0' : _index._input[_index._structurals[_next]];
+        }
+
+        /// \brief Consume \param expected if it is the next token.
+        bool consume(char expected) {
+            if (peek() != expected)
+                return false;
+            ++_next;
+            return true;
+        }
+
+        /// \brief Consume \param literal (e.g. true, false, null) if it is the next token.
+        bool consume_literal(std::string_view literal);
+
+        /// \brief Read the string of the next token, \see JsonCursor::read_string.
+        std::optional<std::string> read_string();
+
+        /// \brief Read the number of the next token, \see JsonCursor::read_number.
+        std::optional<std::string_view> read_number();
+    };
+
+private:
+    /// \brief The indexed text. Not owned.
+    std::string_view _input;
+
+    /// \brief Positions of structural characters, opening quotes and the first
+    /// character of numbers and literals, outside of strings, in order.
+    std::vector<std::uint32_t> _structurals;
+
+    /// \brief Positions of the closing quotes, in order.
+    std::vector<std::uint32_t> _string_ends;
+
+    /// \brief One bit for every character, set for backslashes and control
+    /// characters inside strings. Strings without any can be copied as they are.
+    std::vector<std::uint64_t> _string_escapes;
+
+    /// \brief Whether every string is closed and the text fits the 32 bit positions.
+    bool _valid = false;
+
+    /// \brief The instruction set the index was built with.
+    Implementation _implementation;
+
+    /// \brief Check if any escape bit is set in [begin, end).
+    bool has_escape(std::size_t begin, std::size_t end) const;
+
+public:
+    /// \brief Build the index of \param input with the best instruction set available.
+    explicit JsonStructuralIndex(std::string_view input);
+
+    /// \brief Build the index of \param input with a specific instruction set.
+    /// Falls back to the scalar implementation if the CPU does not support it.
+    JsonStructuralIndex(std::string_view input, Implementation implementation);
+
+    /// \brief The best instruction set supported by the CPU, detected once at runtime.
+    static Implementation best_implementation();
+
+    /// \brief The indexed text.
+    std::string_view input() const {
+        return _input;
+    }
+
+    /// \brief The instruction set the index was built with.
+    Implementation implementation() const {
+        return _implementation;
+    }
+
+    /// \brief Check if the index can be used: every string is closed and the
+    /// text is shorter than 4 GiB.
+    bool valid() const {
+        return _valid;
+    }
+
+    /// \brief Positions of the structural characters, strings and scalars.
+    const std::vector<std::uint32_t>& structurals() const {
+        return _structurals;
+    }
+};
+
+}
+
+#endif //CORE_JSONSTRUCTURALINDEX_HPP
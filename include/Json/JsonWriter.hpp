@@ -0,0 +1,105 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONWRITER_HPP
+#define CORE_JSONWRITER_HPP
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+#include <Json/Json.hpp>
+
+namespace Core {
+
+/// \brief Serializer of Json into a growable buffer.
+/// Numbers are formatted with std::to_chars (doubles in the shortest form that
+/// reads back to the same value, with std::snprintf where the standard library
+/// has no floating point std::to_chars), strings are escaped as the JSON
+/// specification requires. Nothing is written to a stream until the caller
+/// decides so, e.g. with a single std::ostream::write of JsonWriter::buffer.
+class JsonWriter {
+public:
+    /// \brief Layout of the output.
+    enum class Style {
+        Minified,   ///< No whitespace at all.
+        Pretty      ///< One value per line, indented by nesting depth.
+    };
+
+private:
+    /// \brief The output.
+    std::string _buffer;
+
+    Style _style;
+
+    /// \brief Indentation of one nesting level in pretty mode.
+    std::string _indent;
+
+    /// \brief Repeated indentation, grown as deeper levels are written.
+    std::string _indentation;
+
+    /// \brief Start a new line indented for \param depth (pretty mode only).
+    void new_line(unsigned depth);
+
+    void write_json(const Json& json, unsigned depth);
+    void write_value(const Json::Value& value, unsigned depth);
+
+public:
+    /// \brief Construct a writer.
+    /// \param indent indentation of one nesting level in pretty mode.
+    explicit JsonWriter(Style style = Style::Minified, std::string indent = "\t")
+        : _style(style), _indent(std::move(indent)) {}
+
+    /// \brief Append \param json to the buffer.
+    JsonWriter& write(const Json& json);
+
+    /// \brief Append \param value as an escaped JSON string (with the quotes) to the buffer.
+    JsonWriter& write_string(std::string_view value);
+
+    /// \brief Append a number to the buffer.
+    JsonWriter& write_number(long long value);
+
+    /// \brief Append a number to the buffer.
+    /// Whole doubles keep a fraction (e.g. 1.0) so they read back as doubles,
+    /// NaN and infinities are written as null.
+    JsonWriter& write_number(double value);
+
+    /// \brief Append \param text to the buffer as it is, e.g. a separator.
+    JsonWriter& write_raw(std::string_view text) {
+        _buffer.append(text);
+        return *this;
+    }
+
+    /// \brief The output written so far.
+    const std::string& buffer() const {
+        return _buffer;
+    }
+
+    /// \brief Take the output, the buffer is emptied.
+    std::string take() {
+        return std::move(_buffer);
+    }
+
+    /// \brief Empty the buffer, its capacity is kept.
+    void clear() {
+        _buffer.clear();
+    }
+
+    /// \brief Copy the output to \param out.
+    template<class OutputIterator>
+    OutputIterator copy_to(OutputIterator out) const {
+        return std::copy(_buffer.begin(), _buffer.end(), out);
+    }
+
+    /// \brief Serialize \param json into a string.
+    static std::string to_string(const Json& json, Style style = Style::Minified) {
+        JsonWriter writer(style);
+        writer.write(json);
+        return writer.take();
+    }
+};
+
+}
+
+#endif //CORE_JSONWRITER_HPP
@@ -0,0 +1,248 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_LAZYJSON_HPP
+#define CORE_LAZYJSON_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Json/Json.hpp>
+
+namespace Core {
+
+/// \brief JSON document parsed on demand.
+/// Loading validates the text and indexes its structure: every value gets a
+/// node of 8 bytes with its position in the text and, for objects and arrays,
+/// the node following the container, so whole subtrees are skipped in one
+/// step. Strings and numbers are converted (escape sequences decoded) only when
+/// they are accessed, the text is kept as it is.
+/// The text is shared by copies of the document. A document loaded from a file
+/// refers to the memory mapped file instead, which stays mapped as long as any
+/// copy of the document exists, and strings without escapes are viewed in place.
+/// Members of large objects are looked up in a hash table of their keys, built
+/// when the object is first searched and shared by copies of the document.
+/// Unlike Json, whole numbers that do not fit long long are only detected when
+/// they are accessed (the access yields nothing).
+class LazyJson {
+private:
+    /// \brief Indexed value.
+    struct Node {
+        /// \brief Position of the first character of the value (the opening quote of strings).
+        std::uint32_t offset;
+
+        /// \brief Length of the text of scalars (without quotes for strings),
+        /// index of the node following the subtree for objects and arrays.
+        std::uint32_t extent;
+    };
+
+    /// \brief Owner of the text, a std::string or a MappedFile.
+    std::shared_ptr<const void> _storage;
+
+    /// \brief The text of the document.
+    std::string_view _text;
+
+    /// \brief Nodes of the values in document order, keys of objects precede their values.
+    std::vector<Node> _nodes;
+
+    /// \brief Whether the text is a valid document.
+    bool _valid = false;
+
+    /// \brief Objects spanning more nodes are searched through a key table.
+    static constexpr std::size_t key_table_threshold = 32;
+
+    /// \brief Key tables of the large objects searched so far.
+    struct KeyTables {
+        std::mutex guard;
+
+        /// \brief Node of the object -> hash of the decoded key -> node of the key.
+        std::unordered_map<std::size_t, std::unordered_multimap<std::size_t, std::uint32_t>> objects;
+    };
+
+    std::shared_ptr<KeyTables> _key_tables = std::make_shared<KeyTables>();
+
+    /// \brief Take over \param storage and index \param text held by it.
+    LazyJson(std::shared_ptr<const void> storage, std::string_view text);
+
+    /// \brief Index the value at the cursor. Internal use only.
+    bool index_value(JsonCursor& cursor, std::size_t depth);
+
+    /// \brief Index the object or array at the cursor. Internal use only.
+    bool index_container(JsonCursor& cursor, std::size_t depth);
+
+    /// \brief The key table of the object at \param node, built on first use.
+    const std::unordered_multimap<std::size_t, std::uint32_t>& key_table(std::size_t node) const;
+
+public:
+    /// \brief Lightweight handle of a value in the document.
+    /// Valid as long as the document is.
+    class Element {
+    private:
+        friend class LazyJson;
+
+        const LazyJson* _document;
+        std::size_t _node;
+
+        Element(const LazyJson* document, std::size_t node) : _document(document), _node(node) {}
+
+        /// \brief First character of the value.
+        char kind() const {
+            return _document->_text[_document->_nodes[_node].offset];
+        }
+
+        /// \brief Index of the node following this value.
+        std::size_t next() const;
+
+        /// \brief Convert the value into \param value. \returns false if a number does not fit.
+        bool convert(Json::Value& value) const;
+
+    public:
+        /// \brief Type checks.
+        bool is_object() const {
+            return kind() == '{';
+        }
+
+        bool is_array() const {
+            return kind() == '[';
+        }
+
+        bool is_string() const {
+            return kind() == '"';
+        }
+
+        bool is_bool() const {
+            return kind() == 't' || kind() == 'f';
+        }
+
+        bool is_null() const {
+            return kind() == 'n';
+        }
+
+        bool is_number() const {
+            return !is_object() && !is_array() && !is_string() && !is_bool() && !is_null();
+        }
+
+        /// \brief Number of members of objects and elements of arrays, 0 otherwise.
+        /// Duplicated keys are counted individually.
+        std::size_t size() const;
+
+        /// \brief The text of the value (strings without the quotes, escapes kept).
+        std::string_view raw() const;
+
+        /// \brief The string without copying it, valid as long as the document is.
+        /// \returns std::nullopt if not a string or it has escapes to decode.
+        std::optional<std::string_view> view() const {
+            const auto text = raw();
+            if (!is_string() || text.find('\\') != std::string_view::npos)
+                return std::nullopt;
+            return text;
+        }
+
+        /// \brief Find the member \param key (the last one if the key is duplicated).
+        /// \returns std::nullopt if not an object or the key is missing.
+        std::optional<Element> find(std::string_view key) const;
+
+        /// \brief Find the element at \param index.
+        /// \returns std::nullopt if not an array or the index is out of range.
+        std::optional<Element> find(std::size_t index) const;
+
+        /// \brief Object accessor.
+        /// \throws bad_json_access if not an object
+        /// \throws std::out_of_range if the key is missing
+        Element at(std::string_view key) const;
+
+        /// \brief Array accessor.
+        /// \throws bad_json_access if not an array
+        /// \throws std::out_of_range if index >= size()
+        Element at(std::size_t index) const;
+
+        /// \brief Convert the value, objects and arrays are built into Json from the index.
+        /// \returns std::nullopt if a number does not fit long long.
+        std::optional<Json::Value> value() const;
+
+        /// \brief Optionally convert the value to \tparam T.
+        /// \see Json::get
+        template<class T>
+        std::optional<T> get() const {
+            auto converted = value();
+            if (converted && std::holds_alternative<T>(*converted))
+                return std::get<T>(*converted);
+            return std::nullopt;
+        }
+    };
+
+    /// \brief Validate and index \param text, the document keeps it.
+    /// Afterwards the validity flag is set accordingly.
+    explicit LazyJson(std::string text);
+
+    /// \brief Validate and index the file at \param path, memory mapped in place.
+    /// \returns an invalid document if the file can not be read.
+    /// \see MappedFile
+    static LazyJson load(const std::string& path);
+
+    /// \brief Validity check. \returns true if the text is a valid document.
+    bool valid() const {
+        return _valid;
+    }
+
+    /// \brief Validity check for convenience.
+    explicit operator bool() const {
+        return valid();
+    }
+
+    /// \brief The object or array of the document.
+    /// \throws bad_json_access if the document is invalid
+    Element root() const;
+
+    /// \brief Number of keys of the object or elements of the array.
+    std::size_t size() const {
+        return _valid ? root().size() : 0;
+    }
+
+    /// \brief Get part of the document, only the values on the path are visited.
+    /// \see Json::get
+    std::optional<Json::Value> get(const std::string& path) const;
+
+    /// \brief Get part of the document at the precompiled \param path.
+    /// \see LazyJson::get
+    std::optional<Json::Value> get(const JsonPath& path) const;
+
+    /// \brief Optionally retrieve a value of type \tparam T.
+    /// \see Json::get
+    template<class T>
+    std::optional<T> get(const std::string& path) const {
+        auto variant = get(path);
+        if (variant && std::holds_alternative<T>(*variant))
+            return std::get<T>(*variant);
+        return std::nullopt;
+    }
+
+    /// \brief Retrieve a value of type \tparam T, \param fallback_value if it is missing.
+    /// \see Json::get
+    template<class T>
+    T get(const std::string& path, T fallback_value) const {
+        auto optional = get<T>(path);
+        return optional ? *optional : fallback_value;
+    }
+
+    /// \brief Object accessor, \see LazyJson::Element::at.
+    Element at(std::string_view key) const {
+        return root().at(key);
+    }
+
+    /// \brief Array accessor, \see LazyJson::Element::at.
+    Element at(std::size_t index) const {
+        return root().at(index);
+    }
+};
+
+}
+
+#endif //CORE_LAZYJSON_HPP
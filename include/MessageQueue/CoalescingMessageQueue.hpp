@@ -0,0 +1,158 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_COALESCINGMESSAGEQUEUE_HPP
+#define CORE_COALESCINGMESSAGEQUEUE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <MessageQueue/MessageQueue.hpp>
+#include <MessageQueue/MessageQueueReadiness.hpp>
+
+namespace Core {
+
+/// \brief Key-coalescing message queue.
+/// Thread safe queue with latest-value semantics: at most one message is
+/// pending per key. Pushing a message with a key that is already pending
+/// replaces the pending content in place, the message keeps its original
+/// position (and priority) in the queue. The length of the queue is therefore
+/// bounded by the number of distinct keys, not by the rate of updates.
+/// Messages with the same priority are delivered in the order their keys were
+/// first queued.
+/// \param Readiness readiness signalling policy, \see Core::MessageQueue.
+/// \see Core::SelectableCoalescingMessageQueue for a queue that can be waited
+/// on together with other queues.
+template<class Key, class MessageContent, class Hash = std::hash<Key>, class Readiness = NoReadiness>
+class CoalescingMessageQueue : private Readiness {
+private:
+    /// \brief Position of a pending key in the queue.
+    struct Slot {
+        /// \brief Holds the priority the key was first queued with.
+        unsigned priority;
+
+        /// \brief Monotonic sequence number, keeps the order of keys with the same priority.
+        std::uint64_t sequence;
+
+        /// \brief The key of the pending message.
+        Key key;
+
+        /// \brief Comparison operator for the underlying priority queue.
+        bool operator<(const Slot &rhs) const {
+            if (priority != rhs.priority)
+                return priority < rhs.priority;
+            return sequence > rhs.sequence;
+        }
+    };
+
+    /// \brief Guards the queue and the pending messages.
+    mutable std::mutex _queue_guard;
+
+    /// \brief Condition variable to have the ability for users to wait for the next message.
+    mutable std::condition_variable condition_variable;
+
+    /// \brief Order of the pending keys, every pending key is in here exactly once.
+    std::priority_queue<Slot> _queue;
+
+    /// \brief Latest content for every pending key.
+    std::unordered_map<Key, MessageContent, Hash> _pending;
+
+    /// \brief Sequence number of the next newly queued key.
+    std::uint64_t _next_sequence = 0;
+
+public:
+    /// \brief Default construct the empty queue.
+    CoalescingMessageQueue() = default;
+
+    /// \brief Disabled copy constructor.
+    CoalescingMessageQueue(const CoalescingMessageQueue &) = delete;
+
+    /// \brief Disabled copy-assignment operator.
+    CoalescingMessageQueue& operator=(const CoalescingMessageQueue &) = delete;
+
+    /// \brief Check if the queue is empty.
+    bool empty() const {
+        std::unique_lock guard(_queue_guard);
+        return _pending.empty();
+    }
+
+    /// \brief Number of pending messages (equals the number of pending keys).
+    std::size_t size() const {
+        std::unique_lock guard(_queue_guard);
+        return _pending.size();
+    }
+
+    /// \brief Queue message for \param key with default priority (\see MessagePriority::Normal)
+    /// Only viable if the content is constructible from \param args, so keys
+    /// convertible from a priority do not make the overloads ambiguous.
+    template<class ...Args, typename = std::enable_if_t<std::is_constructible_v<MessageContent, Args...>>>
+    void push(const Key &key, Args &&... args) {
+        push(static_cast<unsigned>(MessagePriority::Normal), key, std::forward<Args>(args)...);
+    }
+
+    /// \brief Queue message for \param key with explicit pre-defined \param priority.
+    template<class ...Args>
+    void push(MessagePriority priority, const Key &key, Args &&... args) {
+        push(static_cast<unsigned>(priority), key, std::forward<Args>(args)...);
+    }
+
+    /// \brief Queue message for \param key with arbitrary \param priority.
+    /// If a message is already pending for the key its content is replaced,
+    /// the priority it was originally queued with is kept.
+    template<class ...Args>
+    void push(unsigned priority, const Key &key, Args &&... args) {
+        std::unique_lock guard(_queue_guard);
+        if (auto it = _pending.find(key); it != _pending.end()) {
+            it->second = MessageContent(std::forward<Args>(args)...);
+            return;
+        }
+
+        _pending.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+        _queue.push(Slot{priority, _next_sequence++, key});
+        Readiness::signal_ready();
+        condition_variable.notify_one();
+    }
+
+    /// \brief Retreive the highest-priority message.
+    /// \returns The key and the latest content queued for it.
+    std::pair<Key, MessageContent> take() {
+        std::unique_lock guard(_queue_guard);
+
+        auto key = _queue.top().key;
+        _queue.pop();
+
+        auto node = _pending.extract(key);
+        if (_pending.empty())
+            Readiness::signal_empty();
+        return {std::move(node.key()), std::move(node.mapped())};
+    }
+
+    /// \brief Suspend the thread until the next message arrives.
+    void wait_for_message() const {
+        std::unique_lock guard(_queue_guard);
+        condition_variable.wait(guard, [this]() {
+            return !_pending.empty();
+        });
+    }
+
+protected:
+    /// \brief The readiness descriptor of the queue.
+    /// Only available with a policy that provides one, \see Core::DescriptorReadiness.
+    int readiness_fd() const {
+        std::unique_lock guard(_queue_guard);
+        return Readiness::descriptor(!_pending.empty());
+    }
+};
+
+}
+
+#endif //CORE_COALESCINGMESSAGEQUEUE_HPP
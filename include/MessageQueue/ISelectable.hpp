@@ -0,0 +1,40 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_ISELECTABLE_HPP
+#define CORE_ISELECTABLE_HPP
+
+#include <chrono>
+#include <optional>
+
+namespace Core {
+
+/// \brief Interface of message sources a Selector can wait on.
+/// A source exposes a file descriptor that is readable while the source has
+/// messages available, so it can be waited on together with other sources and
+/// plain file descriptors (e.g. with epoll).
+class ISelectable {
+public:
+    virtual ~ISelectable() = default;
+
+    /// \brief File descriptor that is readable while messages are available.
+    /// The descriptor may also become readable spuriously (e.g. when the
+    /// schedule of the source changes), call ISelectable::ready to confirm.
+    virtual int readiness_fd() const = 0;
+
+    /// \brief The earliest point in time a scheduled message becomes available, if any.
+    /// Scheduled messages do not signal the descriptor by themselves when they
+    /// become due, waiters have to time out on this.
+    virtual std::optional<std::chrono::steady_clock::time_point> next_due() const = 0;
+
+    /// \brief Refresh the readiness state of the source.
+    /// Clears a stale signal on the descriptor.
+    /// \returns true if a message can be taken.
+    virtual bool ready() = 0;
+};
+
+}
+
+#endif //CORE_ISELECTABLE_HPP
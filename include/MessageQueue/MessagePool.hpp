@@ -0,0 +1,131 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_MESSAGEPOOL_HPP
+#define CORE_MESSAGEPOOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <MessageQueue/MessageQueue.hpp>
+
+namespace Core {
+
+/// \brief Slab allocated pool of message contents.
+/// Messages are acquired from the pool, filled in place, pushed through a
+/// MessageQueue as a MessagePool::Handle and returned to the pool automatically
+/// when the consumer drops the handle. Contents are recycled without being
+/// destructed, so buffers they own (strings, vectors) keep their capacity: in
+/// steady state neither the pool nor the messages allocate.
+/// Thread safe, the pool must outlive every handle acquired from it.
+template<class MessageContent>
+class MessagePool {
+private:
+    /// \brief Returns the content to the pool instead of deleting it.
+    struct Release {
+        /// \brief The pool the content belongs to.
+        MessagePool *pool;
+
+        void operator()(MessageContent *content) const {
+            pool->release(content);
+        }
+    };
+
+public:
+    /// \brief Owning handle of a pooled message.
+    using Handle = std::unique_ptr<MessageContent, Release>;
+
+private:
+    /// \brief Guards the slabs and the free list.
+    mutable std::mutex _guard;
+
+    /// \brief Number of messages allocated at once when the pool runs dry.
+    std::size_t _slab_size;
+
+    /// \brief Storage of the messages.
+    std::vector<std::unique_ptr<MessageContent[]>> _slabs;
+
+    /// \brief Messages available for acquisition.
+    /// Its capacity is kept at the number of messages, so releasing never allocates.
+    std::vector<MessageContent *> _free;
+
+    /// \brief Number of messages owned by the pool.
+    std::size_t _capacity = 0;
+
+    /// \brief Allocate a new slab of \param count messages.
+    /// Internal use only, the guard must be held.
+    void grow(std::size_t count) {
+        _slabs.push_back(std::make_unique<MessageContent[]>(count));
+        _capacity += count;
+        _free.reserve(_capacity);
+
+        auto *slab = _slabs.back().get();
+        for (std::size_t i = count; i > 0; --i)
+            _free.push_back(slab + i - 1);
+    }
+
+    /// \brief Put \param content back to the free list.
+    void release(MessageContent *content) {
+        std::unique_lock guard(_guard);
+        _free.push_back(content);
+    }
+
+public:
+    /// \brief Construct the pool.
+    /// \param slab_size number of messages allocated at once when the pool runs dry.
+    /// \param initial_capacity number of messages allocated up front.
+    explicit MessagePool(std::size_t slab_size = 64, std::size_t initial_capacity = 0)
+        : _slab_size(slab_size > 0 ? slab_size : 1) {
+        if (initial_capacity > 0)
+            grow(initial_capacity);
+    }
+
+    /// \brief Disabled copy constructor.
+    MessagePool(const MessagePool &) = delete;
+
+    /// \brief Disabled copy-assignment operator.
+    MessagePool& operator=(const MessagePool &) = delete;
+
+    /// \brief Acquire a message.
+    /// The content is the one last released to the pool (or default constructed),
+    /// it is up to the caller to overwrite it.
+    Handle acquire() {
+        std::unique_lock guard(_guard);
+        if (_free.empty())
+            grow(_slab_size);
+
+        auto *content = _free.back();
+        _free.pop_back();
+        return Handle(content, Release{this});
+    }
+
+    /// \brief Make sure at least \param count messages are owned by the pool.
+    void reserve(std::size_t count) {
+        std::unique_lock guard(_guard);
+        if (count > _capacity)
+            grow(count - _capacity);
+    }
+
+    /// \brief Number of messages owned by the pool.
+    std::size_t capacity() const {
+        std::unique_lock guard(_guard);
+        return _capacity;
+    }
+
+    /// \brief Number of messages that can be acquired without allocation.
+    std::size_t available() const {
+        std::unique_lock guard(_guard);
+        return _free.size();
+    }
+};
+
+/// \brief Message queue carrying pooled messages, \see MessagePool.
+template<class MessageContent, class Metrics = NoMetrics>
+using PooledMessageQueue = MessageQueue<typename MessagePool<MessageContent>::Handle, Metrics>;
+
+}
+
+#endif //CORE_MESSAGEPOOL_HPP
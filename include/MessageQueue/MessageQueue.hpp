@@ -6,9 +6,15 @@
 #ifndef CORE_MESSAGEQUEUE_HPP
 #define CORE_MESSAGEQUEUE_HPP
 
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
-#include <queue>
+#include <optional>
+#include <vector>
+
+#include <MessageQueue/MessageQueueMetrics.hpp>
+#include <MessageQueue/MessageQueueReadiness.hpp>
 
 namespace Core {
 
@@ -24,12 +30,25 @@ enum class MessagePriority : unsigned {
 /// \brief Message queue template class.
 /// Thread safe implementation of a message queue.
 /// Any type can be passed through it.
-template<class MessageContent>
-class MessageQueue {
+/// Messages can be scheduled to become visible at a later point in time
+/// (\see MessageQueue::push_at, MessageQueue::push_after), until then they are
+/// neither counted nor delivered.
+/// \param Metrics instrumentation policy, \see Core::MessageQueueMetrics. The
+/// default Core::NoMetrics records nothing and costs nothing.
+/// \param Readiness readiness signalling policy. The default Core::NoReadiness
+/// signals nothing, \see Core::SelectableMessageQueue for a queue that can be
+/// waited on together with other queues.
+/// The policy is a base so it takes no space if empty.
+template<class MessageContent, class Metrics = NoMetrics, class Readiness = NoReadiness>
+class MessageQueue : private Readiness {
+public:
+    /// \brief Clock used for scheduled delivery.
+    using Clock = std::chrono::steady_clock;
 private:
     /// \brief Message wrapper (internal) type.
     /// Wraps the MessageContent type with its dispatched priority.
-    struct MessageType {
+    /// The instrumentation stamp is a base so it takes no space if empty.
+    struct MessageType : Metrics::Stamp {
         /// \brief Holds the priority of the message
         unsigned priority;
 
@@ -40,7 +59,8 @@ private:
         /// \param priority holds the priority value of the message.
         /// \param args holds the constructor arguments for the wrapped type.
         template<class ...Args>
-        MessageType(unsigned priority, Args &&... args) : priority(priority),
+        MessageType(unsigned priority, Args &&... args) : Metrics::Stamp(Metrics::stamp()),
+                                                          priority(priority),
                                                           content(std::forward<Args>(args)...) {}
 
         /// \brief Comparison operator for the underlying priority queue.
@@ -54,14 +74,78 @@ private:
         }
     };
 
+    /// \brief Message wrapper that is not visible until its due time.
+    struct DelayedMessageType {
+        /// \brief Point in time the message becomes visible.
+        Clock::time_point due;
+
+        /// \brief The message to deliver.
+        MessageType message;
+
+        /// \brief Comparison for the heap of delayed messages, the earliest due is on top.
+        bool operator<(const DelayedMessageType &rhs) const {
+            return due > rhs.due;
+        }
+    };
+
     /// \brief Guards the priority queue.
     mutable std::mutex _queue_guard;
 
     /// \brief Condition variable to have the ability for users to wait for the next message.
     mutable std::condition_variable condition_variable;
 
-    /// \brief Container of the messages.
-    std::priority_queue<MessageType> _queue;
+    /// \brief Container of the messages, kept as a heap with the highest priority on top.
+    /// A plain vector (instead of std::priority_queue) so its storage can be
+    /// reserved and messages can be moved out of it.
+    std::vector<MessageType> _queue;
+
+    /// \brief Heap of the scheduled messages ordered by their due time.
+    std::vector<DelayedMessageType> _delayed;
+
+    /// \brief Instrumentation, updated under the queue guard.
+    mutable Metrics _metrics;
+
+    /// \brief Check if any scheduled message is due at \param now.
+    /// Internal use only, the queue guard must be held.
+    bool has_due(Clock::time_point now) const {
+        return !_delayed.empty() && _delayed.front().due <= now;
+    }
+
+    /// \brief Move every scheduled message that is due at \param now to the queue.
+    /// Internal use only, the queue guard must be held.
+    void promote_due(Clock::time_point now) {
+        if (!has_due(now))
+            return;
+
+        while (has_due(now)) {
+            std::pop_heap(_delayed.begin(), _delayed.end());
+            // time in queue is measured from the point the message became visible, its due time
+            auto &message = _delayed.back().message;
+            static_cast<typename Metrics::Stamp &>(message) = Metrics::stamp_at(_delayed.back().due);
+            _queue.push_back(std::move(message));
+            std::push_heap(_queue.begin(), _queue.end());
+            _delayed.pop_back();
+            _metrics.on_push(_queue.size());
+        }
+        Readiness::signal_ready();
+    }
+
+    /// \brief Schedule an already wrapped message.
+    /// Waiting consumers are woken up only if the message became the earliest one,
+    /// so they can adjust the time they sleep until.
+    void schedule(Clock::time_point due, MessageType message) {
+        std::unique_lock guard(_queue_guard);
+        const bool earliest = _delayed.empty() || due < _delayed.front().due;
+
+        _delayed.push_back(DelayedMessageType{due, std::move(message)});
+        std::push_heap(_delayed.begin(), _delayed.end());
+
+        if (earliest) {
+            condition_variable.notify_all();
+            // Let selectors re-evaluate how long they can sleep
+            Readiness::signal_ready();
+        }
+    }
 public:
     /// \brief Default construct the empty priority queue.
     MessageQueue() = default;
@@ -73,8 +157,18 @@ public:
     MessageType& operator=(const MessageQueue &) = delete;
 
     /// \brief Check if the queue is empty.
+    /// Scheduled messages that are not due yet do not count.
     bool empty() const {
-        return _queue.empty();
+        std::unique_lock guard(_queue_guard);
+        return _queue.empty() && !has_due(Clock::now());
+    }
+
+    /// \brief Pre-allocate storage for \param capacity messages.
+    /// Queueing does not allocate while less messages are pending (scheduled
+    /// messages are stored separately).
+    void reserve(std::size_t capacity) {
+        std::unique_lock guard(_queue_guard);
+        _queue.reserve(capacity);
     }
 
     /// \brief Queue messages with default priority (\see MessagePriority::Normal)
@@ -87,7 +181,10 @@ public:
     template<class ...Args>
     void push(MessagePriority priority, Args &&... args) {
         std::unique_lock guard(_queue_guard);
-        _queue.emplace(static_cast<unsigned>(priority), std::forward<Args>(args)...);
+        _queue.emplace_back(static_cast<unsigned>(priority), std::forward<Args>(args)...);
+        std::push_heap(_queue.begin(), _queue.end());
+        _metrics.on_push(_queue.size());
+        Readiness::signal_ready();
         condition_variable.notify_one();
     }
 
@@ -95,26 +192,110 @@ public:
     template<class ...Args>
     void push(unsigned priority, Args &&... args) {
         std::unique_lock guard(_queue_guard);
-        _queue.emplace(priority, std::forward<Args>(args)...);
+        _queue.emplace_back(priority, std::forward<Args>(args)...);
+        std::push_heap(_queue.begin(), _queue.end());
+        _metrics.on_push(_queue.size());
+        Readiness::signal_ready();
         condition_variable.notify_one();
     }
 
+    /// \brief Queue messages with default priority (\see MessagePriority::Normal)
+    /// that become visible at \param due.
+    template<class ...Args>
+    void push_at(Clock::time_point due, Args &&... args) {
+        push_at(due, MessagePriority::Normal, std::forward<Args>(args)...);
+    }
+
+    /// \brief Queue messages with explicit pre-defined \param priority
+    /// that become visible at \param due.
+    template<class ...Args>
+    void push_at(Clock::time_point due, MessagePriority priority, Args &&... args) {
+        schedule(due, MessageType(static_cast<unsigned>(priority), std::forward<Args>(args)...));
+    }
+
+    /// \brief Queue messages with arbitrary \param priority
+    /// that become visible at \param due.
+    template<class ...Args>
+    void push_at(Clock::time_point due, unsigned priority, Args &&... args) {
+        schedule(due, MessageType(priority, std::forward<Args>(args)...));
+    }
+
+    /// \brief Queue messages that become visible after \param delay.
+    /// Accepts the same priority arguments as MessageQueue::push.
+    template<class Rep, class Period, class ...Args>
+    void push_after(std::chrono::duration<Rep, Period> delay, Args &&... args) {
+        push_at(Clock::now() + std::chrono::duration_cast<Clock::duration>(delay),
+                std::forward<Args>(args)...);
+    }
+
     /// \brief Retreive the highest-priority message.
     /// \returns The content of the message.
     MessageContent take() {
         std::unique_lock guard(_queue_guard);
+        promote_due(Clock::now());
 
-        auto message = _queue.top();
-        _queue.pop();
-        return message.content;
+        std::pop_heap(_queue.begin(), _queue.end());
+        _metrics.on_take(_queue.back(), _queue.size() - 1);
+        auto content = std::move(_queue.back().content);
+        _queue.pop_back();
+        if (_queue.empty())
+            Readiness::signal_empty();
+        return content;
     }
 
     /// \brief Suspend the thread until the next message arrives.
+    /// If only scheduled messages are pending, the thread sleeps until the
+    /// earliest of them is due.
     void wait_for_message() const {
+        const auto wait = Metrics::wait_started();
+        std::unique_lock guard(_queue_guard);
+        while (_queue.empty()) {
+            if (_delayed.empty()) {
+                condition_variable.wait(guard);
+                continue;
+            }
+
+            const auto due = _delayed.front().due;
+            if (due <= Clock::now())
+                break;
+
+            condition_variable.wait_until(guard, due);
+        }
+        _metrics.on_wait(wait);
+    }
+
+    /// \brief Access the instrumentation of the queue.
+    /// The scheduled messages that are due are made visible first, so they are counted.
+    const Metrics& metrics() {
+        std::unique_lock guard(_queue_guard);
+        promote_due(Clock::now());
+        return _metrics;
+    }
+
+    /// \brief The earliest point in time a scheduled message becomes visible, if any.
+    std::optional<Clock::time_point> next_due() const {
+        std::unique_lock guard(_queue_guard);
+        if (_delayed.empty())
+            return std::nullopt;
+        return _delayed.front().due;
+    }
+
+protected:
+    /// \brief The readiness descriptor of the queue.
+    /// Only available with a policy that provides one, \see Core::DescriptorReadiness.
+    int readiness_fd() const {
+        std::unique_lock guard(_queue_guard);
+        return Readiness::descriptor(!_queue.empty());
+    }
+
+    /// \brief Make the due scheduled messages visible and refresh the readiness signal.
+    /// \returns true if a message can be taken.
+    bool ready() {
         std::unique_lock guard(_queue_guard);
-        condition_variable.wait(guard, [this]() {
-            return !empty();
-        });
+        promote_due(Clock::now());
+        if (_queue.empty())
+            Readiness::signal_empty();
+        return !_queue.empty();
     }
 };
 
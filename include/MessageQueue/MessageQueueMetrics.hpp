@@ -0,0 +1,175 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_MESSAGEQUEUEMETRICS_HPP
+#define CORE_MESSAGEQUEUEMETRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Core {
+
+/// \brief Instrumentation policy of MessageQueue that records nothing.
+/// Every hook is an empty inline function and the per-message stamp is an empty
+/// base class, so an uninstrumented queue compiles to the same code as before.
+struct NoMetrics {
+    /// \brief Per-message data recorded when the message becomes visible.
+    struct Stamp {};
+
+    /// \brief Data recorded when a consumer starts waiting.
+    struct WaitStamp {};
+
+    static Stamp stamp() {
+        return {};
+    }
+
+    static Stamp stamp_at(std::chrono::steady_clock::time_point) {
+        return {};
+    }
+
+    static WaitStamp wait_started() {
+        return {};
+    }
+
+    void on_push(std::size_t) {}
+
+    void on_take(const Stamp &, std::size_t) {}
+
+    void on_wait(const WaitStamp &) {}
+};
+
+/// \brief Instrumentation policy of MessageQueue recording depth, throughput and latency.
+/// Usage:
+/// \code
+/// MessageQueue<std::string, MessageQueueMetrics> queue;
+/// ...
+/// auto snapshot = queue.metrics().snapshot();
+/// \endcode
+/// The counters are updated under the queue guard and can be read from any thread.
+class MessageQueueMetrics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Number of buckets of the time-in-queue histogram.
+    /// Bucket i counts the messages that spent [2^(i-1), 2^i) microseconds in the
+    /// queue (bucket 0 those under a microsecond), the last bucket is open-ended.
+    static constexpr std::size_t histogram_buckets = 32;
+
+    /// \brief Per-message data recorded when the message becomes visible.
+    struct Stamp {
+        Clock::time_point enqueued;
+    };
+
+    /// \brief Data recorded when a consumer starts waiting.
+    struct WaitStamp {
+        Clock::time_point started;
+    };
+
+    /// \brief Point-in-time copy of the counters.
+    struct Snapshot {
+        /// \brief Number of messages currently available.
+        std::uint64_t depth = 0;
+
+        /// \brief Highest number of messages that were available at once.
+        std::uint64_t peak_depth = 0;
+
+        /// \brief Number of messages that became available.
+        std::uint64_t enqueued = 0;
+
+        /// \brief Number of messages taken.
+        std::uint64_t dequeued = 0;
+
+        /// \brief Summed time the taken messages spent in the queue.
+        Clock::duration total_time_in_queue{};
+
+        /// \brief Distribution of the time the taken messages spent in the queue.
+        std::array<std::uint64_t, histogram_buckets> time_in_queue_histogram{};
+
+        /// \brief Number of finished MessageQueue::wait_for_message calls.
+        std::uint64_t waits = 0;
+
+        /// \brief Summed time consumers spent in MessageQueue::wait_for_message.
+        Clock::duration total_wait_time{};
+    };
+
+private:
+    std::atomic<std::uint64_t> _depth{0};
+    std::atomic<std::uint64_t> _peak_depth{0};
+    std::atomic<std::uint64_t> _enqueued{0};
+    std::atomic<std::uint64_t> _dequeued{0};
+    std::atomic<Clock::rep> _total_time_in_queue{0};
+    std::array<std::atomic<std::uint64_t>, histogram_buckets> _histogram{};
+    std::atomic<std::uint64_t> _waits{0};
+    std::atomic<Clock::rep> _total_wait_time{0};
+
+    /// \brief Histogram bucket of \param duration.
+    static std::size_t bucket_of(Clock::duration duration) {
+        auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        std::size_t bucket = 0;
+        while (microseconds > 0 && bucket + 1 < histogram_buckets) {
+            microseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+public:
+    static Stamp stamp() {
+        return {Clock::now()};
+    }
+
+    /// \brief Stamp of a message that became visible at \param visible (scheduled messages).
+    static Stamp stamp_at(Clock::time_point visible) {
+        return {visible};
+    }
+
+    static WaitStamp wait_started() {
+        return {Clock::now()};
+    }
+
+    /// \brief A message became available, \param depth messages are available now.
+    void on_push(std::size_t depth) {
+        _enqueued.fetch_add(1, std::memory_order_relaxed);
+        _depth.store(depth, std::memory_order_relaxed);
+        if (depth > _peak_depth.load(std::memory_order_relaxed))
+            _peak_depth.store(depth, std::memory_order_relaxed);
+    }
+
+    /// \brief A message was taken, \param depth messages remained available.
+    void on_take(const Stamp &stamp, std::size_t depth) {
+        const auto time_in_queue = Clock::now() - stamp.enqueued;
+        _dequeued.fetch_add(1, std::memory_order_relaxed);
+        _depth.store(depth, std::memory_order_relaxed);
+        _total_time_in_queue.fetch_add(time_in_queue.count(), std::memory_order_relaxed);
+        _histogram[bucket_of(time_in_queue)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// \brief A consumer finished waiting.
+    void on_wait(const WaitStamp &stamp) {
+        _waits.fetch_add(1, std::memory_order_relaxed);
+        _total_wait_time.fetch_add((Clock::now() - stamp.started).count(), std::memory_order_relaxed);
+    }
+
+    /// \brief Copy the counters.
+    Snapshot snapshot() const {
+        Snapshot snapshot;
+        snapshot.depth = _depth.load(std::memory_order_relaxed);
+        snapshot.peak_depth = _peak_depth.load(std::memory_order_relaxed);
+        snapshot.enqueued = _enqueued.load(std::memory_order_relaxed);
+        snapshot.dequeued = _dequeued.load(std::memory_order_relaxed);
+        snapshot.total_time_in_queue = Clock::duration(_total_time_in_queue.load(std::memory_order_relaxed));
+        for (std::size_t i = 0; i < histogram_buckets; ++i)
+            snapshot.time_in_queue_histogram[i] = _histogram[i].load(std::memory_order_relaxed);
+        snapshot.waits = _waits.load(std::memory_order_relaxed);
+        snapshot.total_wait_time = Clock::duration(_total_wait_time.load(std::memory_order_relaxed));
+        return snapshot;
+    }
+};
+
+}
+
+#endif //CORE_MESSAGEQUEUEMETRICS_HPP
@@ -0,0 +1,26 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_MESSAGEQUEUEREADINESS_HPP
+#define CORE_MESSAGEQUEUEREADINESS_HPP
+
+namespace Core {
+
+/// \brief Readiness policy of the message queues that signals nothing.
+/// Every hook is an empty inline function and the queues inherit the policy,
+/// so a queue that is never waited on by a Selector carries no descriptor, no
+/// virtual functions and no platform specific code.
+/// \see Core::DescriptorReadiness for the selectable counterpart.
+struct NoReadiness {
+    /// \brief Messages became available.
+    void signal_ready() const {}
+
+    /// \brief No messages are available anymore.
+    void signal_empty() const {}
+};
+
+}
+
+#endif //CORE_MESSAGEQUEUEREADINESS_HPP
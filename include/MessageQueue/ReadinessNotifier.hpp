@@ -0,0 +1,145 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_READINESSNOTIFIER_HPP
+#define CORE_READINESSNOTIFIER_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+namespace Core {
+
+/// \brief Level-triggered readiness flag backed by a file descriptor.
+/// The descriptor is readable while the flag is set, so it can be registered in
+/// poll/epoll sets. Backed by an eventfd on Linux and by a pipe elsewhere.
+/// Not thread safe, the owner is expected to serialize the calls.
+class ReadinessNotifier {
+private:
+    /// \brief Descriptor that is waited on.
+    int _read_fd = -1;
+
+    /// \brief Descriptor that is written to signal readiness.
+    int _write_fd = -1;
+
+    /// \brief Mirrors the state of the descriptor, avoids redundant system calls.
+    bool _set = false;
+
+public:
+    /// \brief Create the underlying descriptor(s).
+    /// \throws std::system_error if the descriptors can not be created.
+    ReadinessNotifier() {
+#if defined(__linux__)
+        _read_fd = _write_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_read_fd == -1)
+            throw std::system_error(errno, std::generic_category(), "eventfd");
+#else
+        int fds[2];
+        if (::pipe(fds) == -1)
+            throw std::system_error(errno, std::generic_category(), "pipe");
+        for (auto fd : fds) {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        _read_fd = fds[0];
+        _write_fd = fds[1];
+#endif
+    }
+
+    /// \brief Close the underlying descriptor(s).
+    ~ReadinessNotifier() {
+        ::close(_read_fd);
+        if (_write_fd != _read_fd)
+            ::close(_write_fd);
+    }
+
+    /// \brief Disabled copy constructor.
+    ReadinessNotifier(const ReadinessNotifier &) = delete;
+
+    /// \brief Disabled copy-assignment operator.
+    ReadinessNotifier& operator=(const ReadinessNotifier &) = delete;
+
+    /// \brief The descriptor that is readable while the flag is set.
+    int fd() const {
+        return _read_fd;
+    }
+
+    /// \brief Check the flag.
+    bool is_set() const {
+        return _set;
+    }
+
+    /// \brief Set the flag, the descriptor becomes readable.
+    void set() {
+        if (_set)
+            return;
+#if defined(__linux__)
+        std::uint64_t value = 1;
+#else
+        char value = 1;
+#endif
+        if (::write(_write_fd, &value, sizeof(value)) == sizeof(value))
+            _set = true;
+    }
+
+    /// \brief Clear the flag, the descriptor stops being readable.
+    void clear() {
+        if (!_set)
+            return;
+#if defined(__linux__)
+        std::uint64_t value;
+        while (::read(_read_fd, &value, sizeof(value)) > 0) {}
+#else
+        char buffer[64];
+        while (::read(_read_fd, buffer, sizeof(buffer)) > 0) {}
+#endif
+        _set = false;
+    }
+};
+
+/// \brief Readiness policy of the message queues backed by a ReadinessNotifier.
+/// The descriptor is created on first use, until then signalling is a no-op.
+/// Used by the selectable queues, \see Core::SelectableMessageQueue.
+class DescriptorReadiness {
+private:
+    /// \brief Readiness descriptor, created on first use.
+    mutable std::unique_ptr<ReadinessNotifier> _notifier;
+
+public:
+    /// \brief Messages became available.
+    void signal_ready() const {
+        if (_notifier)
+            _notifier->set();
+    }
+
+    /// \brief No messages are available anymore.
+    void signal_empty() const {
+        if (_notifier)
+            _notifier->clear();
+    }
+
+    /// \brief The readiness descriptor, created if necessary.
+    /// \param available tells if messages are available at the moment of creation.
+    int descriptor(bool available) const {
+        if (!_notifier) {
+            _notifier = std::make_unique<ReadinessNotifier>();
+            if (available)
+                _notifier->set();
+        }
+        return _notifier->fd();
+    }
+};
+
+}
+
+#endif //CORE_READINESSNOTIFIER_HPP
@@ -0,0 +1,75 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_SELECTABLEMESSAGEQUEUE_HPP
+#define CORE_SELECTABLEMESSAGEQUEUE_HPP
+
+#include <chrono>
+#include <functional>
+#include <optional>
+
+#include <MessageQueue/CoalescingMessageQueue.hpp>
+#include <MessageQueue/ISelectable.hpp>
+#include <MessageQueue/MessageQueue.hpp>
+#include <MessageQueue/ReadinessNotifier.hpp>
+
+namespace Core {
+
+/// \brief MessageQueue that can be waited on together with other queues, \see Core::Selector.
+/// Selectability is opt-in: the plain MessageQueue carries no descriptor and
+/// no virtual functions, this one signals its readiness through a file
+/// descriptor (\see Core::DescriptorReadiness).
+template<class MessageContent, class Metrics = NoMetrics>
+class SelectableMessageQueue : public MessageQueue<MessageContent, Metrics, DescriptorReadiness>,
+                               public ISelectable {
+private:
+    using Base = MessageQueue<MessageContent, Metrics, DescriptorReadiness>;
+
+public:
+    using typename Base::Clock;
+
+    /// \copydoc ISelectable::readiness_fd
+    int readiness_fd() const override {
+        return Base::readiness_fd();
+    }
+
+    /// \copydoc ISelectable::next_due
+    std::optional<typename Clock::time_point> next_due() const override {
+        return Base::next_due();
+    }
+
+    /// \copydoc ISelectable::ready
+    bool ready() override {
+        return Base::ready();
+    }
+};
+
+/// \brief CoalescingMessageQueue that can be waited on together with other queues, \see Core::Selector.
+template<class Key, class MessageContent, class Hash = std::hash<Key>>
+class SelectableCoalescingMessageQueue : public CoalescingMessageQueue<Key, MessageContent, Hash, DescriptorReadiness>,
+                                         public ISelectable {
+private:
+    using Base = CoalescingMessageQueue<Key, MessageContent, Hash, DescriptorReadiness>;
+
+public:
+    /// \copydoc ISelectable::readiness_fd
+    int readiness_fd() const override {
+        return Base::readiness_fd();
+    }
+
+    /// \copydoc ISelectable::next_due
+    std::optional<std::chrono::steady_clock::time_point> next_due() const override {
+        return std::nullopt;
+    }
+
+    /// \copydoc ISelectable::ready
+    bool ready() override {
+        return !Base::empty();
+    }
+};
+
+}
+
+#endif //CORE_SELECTABLEMESSAGEQUEUE_HPP
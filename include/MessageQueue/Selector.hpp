@@ -0,0 +1,192 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#pragma once
+#ifndef CORE_SELECTOR_HPP
+#define CORE_SELECTOR_HPP
+
+#if !defined(__linux__)
+#error "Core::Selector is built on epoll and is only available on Linux"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <optional>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <MessageQueue/ISelectable.hpp>
+
+namespace Core {
+
+/// \brief Waits on multiple message sources (and plain file descriptors) at once.
+/// One thread can service many MessageQueues without spinning: the selector
+/// blocks in epoll until any registered source has a message available or any
+/// registered descriptor is readable. Scheduled messages are taken into account
+/// by timing out when the earliest one is due.
+/// The selector itself is an epoll instance, \see Selector::native_handle can be
+/// registered in another event loop to get notified when waiting would return.
+/// Registration and waiting must not be done concurrently.
+class Selector {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Outcome of a wait.
+    struct Result {
+        /// \brief Sources that have at least one message available.
+        std::vector<ISelectable*> sources;
+
+        /// \brief Plain file descriptors that are readable.
+        std::vector<int> fds;
+
+        /// \brief Check if nothing became ready (the wait timed out).
+        bool empty() const {
+            return sources.empty() && fds.empty();
+        }
+    };
+
+private:
+    /// \brief The epoll instance.
+    int _epoll_fd;
+
+    /// \brief Registered sources by their readiness descriptor.
+    std::unordered_map<int, ISelectable*> _sources;
+
+    /// \brief Register \param fd in the epoll set.
+    void watch(int fd) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (::epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1)
+            throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+    }
+
+    /// \brief Remove \param fd from the epoll set.
+    void unwatch(int fd) {
+        ::epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    }
+
+    /// \brief The earliest due time among the registered sources.
+    std::optional<Clock::time_point> next_due() const {
+        std::optional<Clock::time_point> earliest;
+        for (const auto &[fd, source] : _sources) {
+            if (auto due = source->next_due(); due && (!earliest || *due < *earliest))
+                earliest = due;
+        }
+        return earliest;
+    }
+
+    /// \brief Wait until something is ready or \param deadline passes.
+    Result wait_until(std::optional<Clock::time_point> deadline) {
+        Result result;
+        std::array<epoll_event, 64> events{};
+        while (true) {
+            auto wake_up = next_due();
+            if (deadline && (!wake_up || *deadline < *wake_up))
+                wake_up = deadline;
+
+            int timeout = -1;
+            if (wake_up) {
+                using namespace std::chrono;
+                const auto remaining = ceil<milliseconds>(*wake_up - Clock::now()).count();
+                timeout = static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, 1 << 30));
+            }
+
+            const int count = ::epoll_wait(_epoll_fd, events.data(), events.size(), timeout);
+            if (count == -1 && errno != EINTR)
+                throw std::system_error(errno, std::generic_category(), "epoll_wait");
+
+            for (int i = 0; i < count; ++i) {
+                const int fd = events[i].data.fd;
+                if (auto it = _sources.find(fd); it == _sources.end())
+                    result.fds.push_back(fd);
+                else if (it->second->ready())
+                    result.sources.push_back(it->second);
+            }
+
+            // Scheduled messages do not signal their descriptor
+            const auto now = Clock::now();
+            for (const auto &[fd, source] : _sources) {
+                auto due = source->next_due();
+                if (due && *due <= now &&
+                    std::find(result.sources.begin(), result.sources.end(), source) == result.sources.end() &&
+                    source->ready())
+                    result.sources.push_back(source);
+            }
+
+            if (!result.empty() || (deadline && *deadline <= now))
+                return result;
+        }
+    }
+
+public:
+    /// \brief Create the epoll instance.
+    /// \throws std::system_error if it can not be created.
+    Selector() : _epoll_fd(::epoll_create1(EPOLL_CLOEXEC)) {
+        if (_epoll_fd == -1)
+            throw std::system_error(errno, std::generic_category(), "epoll_create1");
+    }
+
+    /// \brief Close the epoll instance. Registered sources are left untouched.
+    ~Selector() {
+        ::close(_epoll_fd);
+    }
+
+    /// \brief Disabled copy constructor.
+    Selector(const Selector &) = delete;
+
+    /// \brief Disabled copy-assignment operator.
+    Selector& operator=(const Selector &) = delete;
+
+    /// \brief The epoll descriptor, readable while a registered descriptor is.
+    int native_handle() const {
+        return _epoll_fd;
+    }
+
+    /// \brief Register a message source. It must outlive its registration.
+    void add(ISelectable &source) {
+        const int fd = source.readiness_fd();
+        watch(fd);
+        _sources.emplace(fd, &source);
+    }
+
+    /// \brief Unregister a message source.
+    void remove(ISelectable &source) {
+        const int fd = source.readiness_fd();
+        unwatch(fd);
+        _sources.erase(fd);
+    }
+
+    /// \brief Register a plain file descriptor that is waited on for reading.
+    void add(int fd) {
+        watch(fd);
+    }
+
+    /// \brief Unregister a plain file descriptor.
+    void remove(int fd) {
+        unwatch(fd);
+    }
+
+    /// \brief Block until any registered source or descriptor is ready.
+    Result wait() {
+        return wait_until(std::nullopt);
+    }
+
+    /// \brief Block until any registered source or descriptor is ready or \param timeout elapses.
+    /// \returns an empty Result on timeout.
+    template<class Rep, class Period>
+    Result wait_for(std::chrono::duration<Rep, Period> timeout) {
+        return wait_until(Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout));
+    }
+};
+
+}
+
+#endif //CORE_SELECTOR_HPP
@@ -6,6 +6,8 @@
 #ifndef CORE_VALUEWRAPPER_HPP
 #define CORE_VALUEWRAPPER_HPP
 
+#include <type_traits>
+#include <utility>
 #include <variant>
 
 #include <Utils/Utils.hpp>
@@ -36,6 +38,17 @@ public:
         return *this;
     }
 
+    /// \brief Construct by moving a value of one of the held types.
+    template<class T, typename = std::enable_if_t<!std::is_lvalue_reference_v<T> && contains<T, Types...>()>>
+    ValueWrapper(T&& value) : Base(std::in_place_type<T>, std::move(value)) {}
+
+    /// \brief Assign by moving a value of one of the held types.
+    template<class T, typename = std::enable_if_t<!std::is_lvalue_reference_v<T> && contains<T, Types...>()>>
+    ValueWrapper& operator=(T&& value) {
+        Base::operator=(Base(std::in_place_type<T>, std::move(value)));
+        return *this;
+    }
+
     /// \brief Check equality. If the variant does not hold the type, returns obviously false.
     template<class T, typename = std::enable_if_t<contains<T, Types...>()>>
     bool operator==(const T& value) const {
@@ -0,0 +1,97 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <FileManager/MappedFile.hpp>
+
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace Core {
+
+#if defined(__unix__) || defined(__APPLE__)
+
+MappedFile::MappedFile(const std::string& path) {
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+        return;
+
+    struct stat status {};
+    if (::fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode)) {
+        _size = static_cast<std::size_t>(status.st_size);
+        if (_size == 0) {
+            _valid = true;
+        } else {
+            void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapping != MAP_FAILED) {
+                // The document is scanned front to back
+                ::madvise(mapping, _size, MADV_SEQUENTIAL);
+                _data = static_cast<const char*>(mapping);
+                _mapped = true;
+                _valid = true;
+            } else {
+                _size = 0;
+            }
+        }
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(descriptor);
+}
+
+void MappedFile::release() {
+    if (_mapped)
+        ::munmap(const_cast<char*>(_data), _size);
+    else
+        delete[] _data;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return;
+
+    _size = static_cast<std::size_t>(file.tellg());
+    auto* buffer = _size > 0 ? new char[_size] : nullptr;
+    file.seekg(0);
+    if (_size > 0 && !file.read(buffer, static_cast<std::streamsize>(_size))) {
+        delete[] buffer;
+        _size = 0;
+        return;
+    }
+    _data = buffer;
+    _valid = true;
+}
+
+void MappedFile::release() {
+    delete[] _data;
+}
+
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)),
+      _mapped(std::exchange(other._mapped, false)), _valid(std::exchange(other._valid, false)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+        _mapped = std::exchange(other._mapped, false);
+        _valid = std::exchange(other._valid, false);
+    }
+    return *this;
+}
+
+}
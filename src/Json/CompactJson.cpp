@@ -0,0 +1,243 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/CompactJson.hpp>
+#include <Json/JsonCursor.hpp>
+
+#include <charconv>
+#include <stdexcept>
+
+namespace Core {
+
+CompactJson::Node CompactJson::make_string(std::string_view raw) {
+    Node node{Type::String, 0, {}};
+    node.offset = _strings.size();
+    JsonCursor::unescape(raw, _strings);
+    node.size = static_cast<std::uint32_t>(_strings.size() - node.offset);
+    return node;
+}
+
+bool CompactJson::parse_value(JsonCursor& cursor, std::vector<Node>& stack, std::size_t depth) {
+    Node node{Type::Null, 0, {}};
+    switch (cursor.peek()) {
+        case '{':
+        case '[':
+            return parse_container(cursor, stack, depth + 1);
+        case '"': {
+            auto text = cursor.read_raw_string();
+            if (!text)
+                return false;
+            node = make_string(*text);
+            break;
+        }
+        case 'n':
+            if (!cursor.consume_literal("null"))
+                return false;
+            break;
+        case 't':
+        case 'f':
+            node.type = Type::Bool;
+            node.boolean = cursor.peek() == 't';
+            if (!cursor.consume_literal(node.boolean ? "true" : "false"))
+                return false;
+            break;
+        default: {
+            auto text = cursor.read_number();
+            if (!text)
+                return false;
+
+            const auto* end = text->data() + text->size();
+            if (text->find_first_of(".eE") == std::string_view::npos) {
+                node.type = Type::Integer;
+                if (std::from_chars(text->data(), end, node.integer).ec != std::errc())
+                    return false;
+            } else {
+                node.type = Type::Double;
+                node.number = 0;
+                if (!JsonCursor::to_double(*text, node.number))
+                    return false;
+            }
+            break;
+        }
+    }
+
+    stack.push_back(node);
+    return true;
+}
+
+bool CompactJson::parse_container(JsonCursor& cursor, std::vector<Node>& stack, std::size_t depth) {
+    const auto opening = cursor.peek();
+    const auto closing = opening == '{' ? '}' : ']';
+    if (depth > Json::max_depth || !cursor.consume(opening))
+        return false;
+
+    // Children are parsed onto the stack, then moved next to each other into the node array
+    const auto first_child = stack.size();
+    std::uint32_t size = 0;
+    if (!cursor.consume(closing)) {
+        do {
+            if (opening == '{') {
+                if (cursor.peek() != '"')
+                    return false;
+
+                auto key = cursor.read_raw_string();
+                if (!key || !cursor.consume(':'))
+                    return false;
+                stack.push_back(make_string(*key));
+            }
+
+            if (!parse_value(cursor, stack, depth))
+                return false;
+            ++size;
+        } while (cursor.consume(','));
+
+        if (!cursor.consume(closing))
+            return false;
+    }
+
+    Node node{opening == '{' ? Type::Object : Type::Array, size, {}};
+    node.offset = _nodes.size();
+    _nodes.insert(_nodes.end(), stack.begin() + static_cast<std::ptrdiff_t>(first_child), stack.end());
+    stack.resize(first_child);
+    stack.push_back(node);
+    return true;
+}
+
+CompactJson::CompactJson(std::string_view text) {
+    if (text.size() >= std::numeric_limits<std::uint32_t>::max())
+        return;
+
+    std::vector<Node> stack;
+    JsonCursor cursor(text);
+    const auto first = cursor.peek();
+    _valid = (first == '{' || first == '[') && parse_container(cursor, stack, 1);
+
+    cursor.skip_whitespace();
+    if (!_valid || !cursor.at_end()) {
+        _valid = false;
+        _nodes.clear();
+        _strings.clear();
+    } else {
+        _nodes.push_back(stack.back());
+    }
+    _nodes.shrink_to_fit();
+    _strings.shrink_to_fit();
+}
+
+CompactJson::Element CompactJson::root() const {
+    if (!_valid)
+        throw bad_json_access("Invalid JSON");
+    return Element(this, &_nodes.back());
+}
+
+std::optional<CompactJson::Element> CompactJson::find_path(const std::string& path) const {
+    return find_path(JsonPath(path));
+}
+
+std::optional<CompactJson::Element> CompactJson::find_path(const JsonPath& path) const {
+    if (!_valid || path.empty())
+        return std::nullopt;
+
+    auto element = std::optional(root());
+    for (const auto& segment : path) {
+        if (segment.is_index())
+            element = element->find(segment.index());
+        else if (segment.escaped())
+            element = element->find(std::string_view(segment.key()));
+        else
+            element = element->find(segment.raw_key());
+
+        if (!element)
+            return std::nullopt;
+    }
+    return element;
+}
+
+std::optional<CompactJson::Element> CompactJson::Element::find(std::string_view key) const {
+    if (!is_object())
+        return std::nullopt;
+
+    // Searched backwards, so the last of duplicated keys wins as in Json
+    for (auto index = size(); index > 0; --index) {
+        const auto* key_node = child(2 * index - 2);
+        if (Element(_document, key_node).get<std::string_view>() == key)
+            return Element(_document, key_node + 1);
+    }
+    return std::nullopt;
+}
+
+std::optional<CompactJson::Element> CompactJson::Element::find(std::size_t index) const {
+    if (!is_array() || index >= size())
+        return std::nullopt;
+    return Element(_document, child(index));
+}
+
+CompactJson::Element CompactJson::Element::at(std::string_view key) const {
+    if (!is_object())
+        throw bad_json_access("Not a JSON Object");
+
+    if (auto element = find(key))
+        return *element;
+    throw std::out_of_range("No such key");
+}
+
+CompactJson::Element CompactJson::Element::at(std::size_t index) const {
+    if (!is_array())
+        throw bad_json_access("Not a JSON Array");
+
+    if (auto element = find(index))
+        return *element;
+    throw std::out_of_range("Index is out of range");
+}
+
+std::pair<std::string_view, CompactJson::Element> CompactJson::Element::member(std::size_t index) const {
+    if (!is_object())
+        throw bad_json_access("Not a JSON Object");
+    if (index >= size())
+        throw std::out_of_range("Index is out of range");
+
+    const auto* key_node = child(2 * index);
+    return {*Element(_document, key_node).get<std::string_view>(), Element(_document, key_node + 1)};
+}
+
+std::optional<Json::Value> CompactJson::Element::value() const {
+    switch (type()) {
+        case Type::Null:
+            return Json::Value(Json::Null());
+        case Type::Bool:
+            return Json::Value(_node->boolean);
+        case Type::Integer:
+            if (auto integer = get<int>())
+                return Json::Value(*integer);
+            if (auto integer = get<long>())
+                return Json::Value(*integer);
+            return Json::Value(static_cast<long long>(_node->integer));
+        case Type::Double:
+            return Json::Value(_node->number);
+        case Type::String:
+            return Json::Value(*get<std::string>());
+        case Type::Array: {
+            // Children are built once and moved into their parent, subtrees are never copied
+            auto array = Json::create_array();
+            for (std::size_t i = 0; i < size(); ++i)
+                array.push_back(std::move(*Element(_document, child(i)).value()));
+            return std::optional<Json::Value>(std::in_place, std::move(array));
+        }
+        case Type::Object: {
+            auto object = Json::create_object();
+            for (std::size_t i = 0; i < size(); ++i) {
+                auto [key, element] = member(i);
+                object[std::string(key)] = std::move(*element.value());
+            }
+            return std::optional<Json::Value>(std::in_place, std::move(object));
+        }
+    }
+    return std::nullopt;
+}
+
+Json CompactJson::to_json() const {
+    return std::get<Json>(*root().value());
+}
+
+}
@@ -0,0 +1,42 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonBinding.hpp>
+
+namespace Core {
+
+bool JsonBinder::skip_value(JsonCursor& cursor, std::size_t depth) {
+    switch (cursor.peek()) {
+        case '{':
+        case '[': {
+            const bool object = cursor.peek() == '{';
+            const auto closing = object ? '}' : ']';
+            if (depth + 1 > Json::max_depth)
+                return false;
+
+            cursor.consume(object ? '{' : '[');
+            if (cursor.consume(closing))
+                return true;
+            do {
+                if (object && (cursor.peek() != '"' || !cursor.read_raw_string() || !cursor.consume(':')))
+                    return false;
+                if (!skip_value(cursor, depth + 1))
+                    return false;
+            } while (cursor.consume(','));
+            return cursor.consume(closing);
+        }
+        case '"':
+            return cursor.read_raw_string().has_value();
+        case 'n':
+            return cursor.consume_literal("null");
+        case 't':
+            return cursor.consume_literal("true");
+        case 'f':
+            return cursor.consume_literal("false");
+        default:
+            return cursor.read_number().has_value();
+    }
+}
+
+}
@@ -0,0 +1,84 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonBuilder.hpp>
+
+namespace Core {
+
+bool JsonBuilder::add(Json::Value value) {
+    auto& data = _stack.back().container._data;
+    if (auto* object = std::get_if<Json::JsonObject>(&data))
+        object->insert_or_assign(_key, std::move(value));
+    else
+        std::get<Json::JsonArray>(data).push_back(std::move(value));
+    return true;
+}
+
+bool JsonBuilder::on_object_begin() {
+    _stack.emplace_back(false, std::move(_key));
+    return true;
+}
+
+bool JsonBuilder::on_array_begin() {
+    _stack.emplace_back(true, std::move(_key));
+    return true;
+}
+
+bool JsonBuilder::on_object_end() {
+    auto frame = std::move(_stack.back());
+    _stack.pop_back();
+
+    if (_stack.empty()) {
+        _document = std::move(frame.container);
+        return !_stop_at_end;
+    }
+
+    _key = std::move(frame.key);
+    return add(std::move(frame.container));
+}
+
+bool JsonBuilder::on_array_end() {
+    return on_object_end();
+}
+
+bool JsonBuilder::on_key(std::string_view key) {
+    _key.assign(key);
+    return true;
+}
+
+bool JsonBuilder::on_string(std::string_view value) {
+    return add(std::string(value));
+}
+
+bool JsonBuilder::on_number(std::string_view number) {
+    auto value = Json::parse_number(number);
+    if (!value) {
+        _failed = true;
+        return false;
+    }
+    return add(std::move(*value));
+}
+
+bool JsonBuilder::on_bool(bool value) {
+    return add(value);
+}
+
+bool JsonBuilder::on_null() {
+    return add(Json::Null());
+}
+
+std::optional<Json> JsonBuilder::take() {
+    auto document = std::move(_document);
+    reset();
+    return document;
+}
+
+void JsonBuilder::reset() {
+    _stack.clear();
+    _key.clear();
+    _document.reset();
+    _failed = false;
+}
+
+}
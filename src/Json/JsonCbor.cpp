@@ -0,0 +1,327 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonCbor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <Utils/Utils.hpp>
+
+namespace Core {
+
+namespace {
+
+constexpr std::uint8_t major_unsigned = 0;
+constexpr std::uint8_t major_negative = 1;
+constexpr std::uint8_t major_bytes = 2;
+constexpr std::uint8_t major_text = 3;
+constexpr std::uint8_t major_array = 4;
+constexpr std::uint8_t major_map = 5;
+constexpr std::uint8_t major_tag = 6;
+constexpr std::uint8_t major_simple = 7;
+
+constexpr std::uint8_t cbor_false = 0xf4;
+constexpr std::uint8_t cbor_true = 0xf5;
+constexpr std::uint8_t cbor_null = 0xf6;
+constexpr std::uint8_t cbor_single = 0xfa;
+constexpr std::uint8_t cbor_double = 0xfb;
+constexpr std::uint8_t cbor_break = 0xff;
+
+/// \brief Append \param bytes bytes of \param value in network byte order.
+void append_big_endian(std::uint64_t value, int bytes, std::vector<std::uint8_t>& output) {
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+        output.push_back(static_cast<std::uint8_t>(value >> shift));
+}
+
+/// \brief Value of an IEEE 754 half precision float.
+double half_to_double(std::uint16_t half) {
+    const int exponent = (half >> 10) & 0x1f;
+    const int mantissa = half & 0x3ff;
+
+    double value;
+    if (exponent == 0)
+        value = std::ldexp(mantissa, -24);
+    else if (exponent != 31)
+        value = std::ldexp(mantissa + 1024, exponent - 25);
+    else
+        value = mantissa == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    return half & 0x8000 ? -value : value;
+}
+
+}
+
+void JsonCbor::encode_head(std::uint8_t major, std::uint64_t argument, std::vector<std::uint8_t>& output) {
+    const auto initial = static_cast<std::uint8_t>(major << 5);
+    if (argument < 24) {
+        output.push_back(static_cast<std::uint8_t>(initial | argument));
+    } else if (argument <= std::numeric_limits<std::uint8_t>::max()) {
+        output.push_back(initial | 24);
+        append_big_endian(argument, 1, output);
+    } else if (argument <= std::numeric_limits<std::uint16_t>::max()) {
+        output.push_back(initial | 25);
+        append_big_endian(argument, 2, output);
+    } else if (argument <= std::numeric_limits<std::uint32_t>::max()) {
+        output.push_back(initial | 26);
+        append_big_endian(argument, 4, output);
+    } else {
+        output.push_back(initial | 27);
+        append_big_endian(argument, 8, output);
+    }
+}
+
+void JsonCbor::encode_value(const Json::Value& value, std::vector<std::uint8_t>& output) {
+    visit_variant(value.to_std_variant(), [&output](const Json& json) {
+        encode_json(json, output);
+    }, [&output](const std::string& string) {
+        encode_head(major_text, string.size(), output);
+        output.insert(output.end(), string.begin(), string.end());
+    }, [&output](const Json::Null&) {
+        output.push_back(cbor_null);
+    }, [&output](const bool& boolean) {
+        output.push_back(boolean ? cbor_true : cbor_false);
+    }, [&output](const double& number) {
+        // Single precision is enough for many values, e.g. 1.5 or 0.25
+        const auto single = static_cast<float>(number);
+        if (static_cast<double>(single) == number || std::isnan(number)) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &single, sizeof(bits));
+            output.push_back(cbor_single);
+            append_big_endian(bits, 4, output);
+        } else {
+            std::uint64_t bits;
+            std::memcpy(&bits, &number, sizeof(bits));
+            output.push_back(cbor_double);
+            append_big_endian(bits, 8, output);
+        }
+    }, [&output](const auto& number) {
+        const auto integer = static_cast<long long>(number);
+        const auto major = integer >= 0 ? major_unsigned : major_negative;
+        const auto argument = static_cast<std::uint64_t>(integer >= 0 ? integer : -(integer + 1));
+        if constexpr (std::is_same_v<std::decay_t<decltype(number)>, long long>) {
+            // Always the 8-byte argument, which tells long long apart when decoding
+            output.push_back(static_cast<std::uint8_t>(major << 5 | 27));
+            append_big_endian(argument, 8, output);
+        } else {
+            encode_head(major, argument, output);
+        }
+    });
+}
+
+void JsonCbor::encode_json(const Json& json, std::vector<std::uint8_t>& output) {
+    visit_variant(json._data, [&output](const Json::JsonArray& array) {
+        encode_head(major_array, array.size(), output);
+        for (const auto& element : array)
+            encode_value(element, output);
+    }, [&output](const Json::JsonObject& object) {
+        encode_head(major_map, object.size(), output);
+        for (const auto& [key, member] : object) {
+            encode_head(major_text, key.size(), output);
+            output.insert(output.end(), key.begin(), key.end());
+            encode_value(member, output);
+        }
+    });
+}
+
+void JsonCbor::encode(const Json& json, std::vector<std::uint8_t>& output) {
+    encode_json(json, output);
+}
+
+bool JsonCbor::decode_head(Reader& reader, std::uint8_t& initial, std::optional<std::uint64_t>& argument) {
+    if (reader.position == reader.size)
+        return false;
+
+    initial = reader.data[reader.position++];
+    const auto additional = initial & 0x1f;
+    if (additional < 24) {
+        argument = additional;
+        return true;
+    }
+    if (additional == 31) {
+        argument = std::nullopt;
+        return true;
+    }
+    if (additional > 27)
+        return false;
+
+    const std::size_t bytes = std::size_t(1) << (additional - 24);
+    if (reader.size - reader.position < bytes)
+        return false;
+
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < bytes; ++i)
+        value = value << 8 | reader.data[reader.position++];
+    argument = value;
+    return true;
+}
+
+bool JsonCbor::decode_string(Reader& reader, std::optional<std::uint64_t> length, std::string& string) {
+    if (length) {
+        if (reader.size - reader.position < *length)
+            return false;
+        string.append(reinterpret_cast<const char*>(reader.data + reader.position), *length);
+        reader.position += *length;
+        return true;
+    }
+
+    // Indefinite length strings are definite length chunks up to a break code
+    while (true) {
+        std::uint8_t initial = 0;
+        std::optional<std::uint64_t> chunk;
+        if (!decode_head(reader, initial, chunk))
+            return false;
+        if (initial == cbor_break)
+            return true;
+        if (initial >> 5 != major_text || !chunk || !decode_string(reader, chunk, string))
+            return false;
+    }
+}
+
+bool JsonCbor::decode_container(Reader& reader, bool object, std::optional<std::uint64_t> size,
+                                Json::Value& value, std::size_t depth) {
+    if (depth > Json::max_depth)
+        return false;
+
+    // Reads the next item unless it is the break code ending an indefinite length container
+    std::uint64_t read = 0;
+    const auto has_next = [&reader, &size, &read]() {
+        if (size)
+            return read++ < *size;
+        if (reader.position < reader.size && reader.data[reader.position] == cbor_break) {
+            ++reader.position;
+            return false;
+        }
+        return true;
+    };
+
+    // Every item takes at least a byte (members two), a bogus size can not make it allocate more than the input
+    const auto remaining = (reader.size - reader.position) / (object ? 2 : 1);
+    const auto reserved = static_cast<std::size_t>(std::min<std::uint64_t>(size.value_or(0), remaining));
+
+    if (object) {
+        Json::JsonObject members;
+        members.reserve(reserved);
+        while (has_next()) {
+            std::uint8_t initial = 0;
+            std::optional<std::uint64_t> length;
+            std::string key;
+            if (!decode_head(reader, initial, length) || initial >> 5 != major_text
+                || !decode_string(reader, length, key))
+                return false;
+
+            Json::Value member;
+            if (!decode_value(reader, member, depth))
+                return false;
+            members.insert_or_assign(std::move(key), std::move(member));
+        }
+        value = Json(std::move(members));
+    } else {
+        Json::JsonArray elements;
+        elements.reserve(reserved);
+        while (has_next()) {
+            elements.emplace_back();
+            if (!decode_value(reader, elements.back(), depth))
+                return false;
+        }
+        value = Json(std::move(elements));
+    }
+    return true;
+}
+
+bool JsonCbor::decode_value(Reader& reader, Json::Value& value, std::size_t depth) {
+    std::uint8_t initial = 0;
+    std::optional<std::uint64_t> argument;
+    if (!decode_head(reader, initial, argument))
+        return false;
+
+    const auto major = static_cast<std::uint8_t>(initial >> 5);
+    const auto max = static_cast<std::uint64_t>(std::numeric_limits<long long>::max());
+    switch (major) {
+        case major_unsigned:
+        case major_negative: {
+            if (!argument || *argument > max)
+                return false;
+
+            const auto integer = major == major_unsigned ? static_cast<long long>(*argument)
+                                                         : -1 - static_cast<long long>(*argument);
+            // An 8-byte argument that 4 bytes could hold was written for a long long
+            const auto wide = (initial & 0x1f) == 27 && *argument <= std::numeric_limits<std::uint32_t>::max();
+            if (wide)
+                value = integer;
+            else if (integer >= std::numeric_limits<int>::min() && integer <= std::numeric_limits<int>::max())
+                value = static_cast<int>(integer);
+            else if (integer >= std::numeric_limits<long>::min() && integer <= std::numeric_limits<long>::max())
+                value = static_cast<long>(integer);
+            else
+                value = integer;
+            return true;
+        }
+        case major_text: {
+            std::string string;
+            if (!decode_string(reader, argument, string))
+                return false;
+            value = std::move(string);
+            return true;
+        }
+        case major_array:
+        case major_map:
+            return decode_container(reader, major == major_map, argument, value, depth + 1);
+        case major_tag:
+            // Tags only add semantics to the item following them
+            return argument && depth < Json::max_depth && decode_value(reader, value, depth + 1);
+        case major_simple:
+            break;
+        case major_bytes:
+        default:
+            return false;
+    }
+
+    switch (initial) {
+        case cbor_false:
+            value = false;
+            return true;
+        case cbor_true:
+            value = true;
+            return true;
+        case cbor_null:
+            value = Json::Null();
+            return true;
+        case 0xf9:
+            value = half_to_double(static_cast<std::uint16_t>(*argument));
+            return true;
+        case cbor_single: {
+            const auto bits = static_cast<std::uint32_t>(*argument);
+            float single;
+            std::memcpy(&single, &bits, sizeof(single));
+            value = static_cast<double>(single);
+            return true;
+        }
+        case cbor_double: {
+            const auto bits = *argument;
+            double number;
+            std::memcpy(&number, &bits, sizeof(number));
+            value = number;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+std::optional<Json> JsonCbor::decode(const std::uint8_t* data, std::size_t size) {
+    Reader reader{data, size};
+    const auto major = size > 0 ? data[0] >> 5 : 0;
+    if (major != major_array && major != major_map)
+        return std::nullopt;
+
+    Json::Value value;
+    if (!decode_value(reader, value, 0) || reader.position != reader.size)
+        return std::nullopt;
+    return std::optional<Json>(std::in_place, std::move(std::get<Json>(value)));
+}
+
+}
@@ -0,0 +1,312 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonCursor.hpp>
+
+#include <cerrno>
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Core {
+
+namespace {
+bool is_digit(char character) {
+    return character >= '0' && character <= '9';
+}
+
+bool is_hex_digit(char character) {
+    return is_digit(character) || (character >= 'a' && character <= 'f') || (character >= 'A' && character <= 'F');
+}
+
+/// \brief Decode the escape sequences of \param raw, the decoded text is passed
+/// to \param sink in pieces, decoding stops when it returns false.
+/// \returns false if it was stopped by the sink.
+template<class Sink>
+bool decode(std::string_view raw, Sink&& sink) {
+    const auto hex_value = [](std::string_view digits) {
+        unsigned value = 0;
+        for (auto digit : digits) {
+            value <<= 4;
+            if (is_digit(digit))
+                value |= static_cast<unsigned>(digit - '0');
+            else
+                value |= static_cast<unsigned>((digit | 0x20) - 'a' + 10);
+        }
+        return value;
+    };
+    const auto encode_utf8 = [](unsigned code_point, char* bytes) -> std::size_t {
+        if (code_point < 0x80) {
+            bytes[0] = static_cast<char>(code_point);
+            return 1;
+        }
+        if (code_point < 0x800) {
+            bytes[0] = static_cast<char>(0xC0 | (code_point >> 6));
+            bytes[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 2;
+        }
+        if (code_point < 0x10000) {
+            bytes[0] = static_cast<char>(0xE0 | (code_point >> 12));
+            bytes[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            bytes[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 3;
+        }
+        bytes[0] = static_cast<char>(0xF0 | (code_point >> 18));
+        bytes[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        bytes[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        bytes[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 4;
+    };
+
+    std::size_t position = 0;
+    while (position < raw.size()) {
+        const auto escape = raw.find('\\', position);
+        if (!sink(raw.substr(position, escape - position)))
+            return false;
+        if (escape == std::string_view::npos)
+            break;
+
+        char decoded[4];
+        std::size_t length = 1;
+        const auto kind = raw[escape + 1];
+        position = escape + 2;
+        switch (kind) {
+            case 'b':
+                decoded[0] = '\b';
+                break;
+            case 'f':
+                decoded[0] = '\f';
+                break;
+            case 'n':
+                decoded[0] = '\n';
+                break;
+            case 'r':
+                decoded[0] = '\r';
+                break;
+            case 't':
+                decoded[0] = '\t';
+                break;
+            case 'u': {
+                auto code_point = hex_value(raw.substr(position, 4));
+                position += 4;
+
+                // A high surrogate followed by a low one encodes a single code point
+                const auto low_follows = raw.substr(position, 2) == "\\u";
+                if (code_point >= 0xD800 && code_point < 0xDC00 && low_follows) {
+                    const auto low = hex_value(raw.substr(position + 2, 4));
+                    if (low >= 0xDC00 && low < 0xE000) {
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                        position += 6;
+                    }
+                }
+
+                // Unpaired surrogates can not be encoded in UTF-8, they are replaced
+                if (code_point >= 0xD800 && code_point < 0xE000)
+                    code_point = 0xFFFD;
+                length = encode_utf8(code_point, decoded);
+                break;
+            }
+            default:
+                // " \ and /
+                decoded[0] = kind;
+                break;
+        }
+        if (!sink(std::string_view(decoded, length)))
+            return false;
+    }
+    return true;
+}
+}
+
+bool JsonCursor::consume_literal(std::string_view literal) {
+    // On a mismatch the cursor stops at the first character that differs
+    for (const auto character : literal) {
+        if (at_end() || _input[_position] != character)
+            return false;
+        ++_position;
+    }
+    return true;
+}
+
+std::size_t JsonCursor::find_special_character(std::string_view text, std::size_t position) {
+    const auto is_special = [](char character) {
+        return character == '"' || character == '\\' || static_cast<unsigned char>(character) < 0x20;
+    };
+
+#if defined(__SSE2__)
+    const auto quote = _mm_set1_epi8('"');
+    const auto backslash = _mm_set1_epi8('\\');
+    const auto control = _mm_set1_epi8(0x1f);
+    for (; position + 16 <= text.size(); position += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + position));
+        // Unsigned characters up to 0x1f are the ones equal to their maximum with 0x1f
+        const auto special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                                          _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control));
+        if (const auto mask = _mm_movemask_epi8(special))
+            return position + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+    }
+#endif
+
+    while (position < text.size() && !is_special(text[position]))
+        ++position;
+    return position;
+}
+
+std::optional<std::string> JsonCursor::read_string() {
+    bool escaped = false;
+    const auto raw = scan_string(escaped);
+    if (!raw)
+        return std::nullopt;
+    // Strings without escapes are copied as they are
+    if (!escaped)
+        return std::string(*raw);
+    return unescape(*raw);
+}
+
+void JsonCursor::unescape(std::string_view raw, std::string& output) {
+    output.reserve(output.size() + raw.size());
+    decode(raw, [&output](std::string_view piece) {
+        output.append(piece);
+        return true;
+    });
+}
+
+bool JsonCursor::unescaped_equals(std::string_view raw, std::string_view text) {
+    if (raw.find('\\') == std::string_view::npos)
+        return raw == text;
+
+    // Decoded pieces are matched against the front of the text as they come
+    return decode(raw, [&text](std::string_view piece) {
+        if (text.substr(0, piece.size()) != piece)
+            return false;
+        text.remove_prefix(piece.size());
+        return true;
+    }) && text.empty();
+}
+
+std::optional<std::string_view> JsonCursor::read_raw_string() {
+    bool escaped = false;
+    return scan_string(escaped);
+}
+
+std::optional<std::string_view> JsonCursor::scan_string(bool& escaped) {
+    if (at_end() || _input[_position] != '"')
+        return std::nullopt;
+
+    const auto begin = ++_position;
+    for (;;) {
+        // Plain characters are skipped in bulk, stop at the closing quote or an escape
+        _position = find_special_character(_input, _position);
+        if (at_end())
+            return std::nullopt;
+
+        const auto current = _input[_position];
+        if (current == '"') {
+            const auto result = _input.substr(begin, _position - begin);
+            ++_position;
+            return result;
+        }
+        if (current != '\\')
+            return std::nullopt;
+
+        escaped = true;
+        if (++_position >= _input.size())
+            return std::nullopt;
+        switch (_input[_position]) {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                break;
+            case 'u':
+                for (int i = 0; i < 4; ++i) {
+                    if (++_position >= _input.size() || !is_hex_digit(_input[_position]))
+                        return std::nullopt;
+                }
+                break;
+            default:
+                return std::nullopt;
+        }
+        ++_position;
+    }
+}
+
+std::optional<std::string_view> JsonCursor::read_number() {
+    const auto begin = _position;
+    const auto digit_at = [this](std::size_t position) {
+        return position < _input.size() && is_digit(_input[position]);
+    };
+    const auto skip_digits = [this, &digit_at]() {
+        const auto first = _position;
+        while (digit_at(_position))
+            ++_position;
+        return _position != first;
+    };
+
+    if (_position < _input.size() && _input[_position] == '-')
+        ++_position;
+
+    if (_position < _input.size() && _input[_position] == '0')
+        ++_position;
+    else if (!skip_digits())
+        return std::nullopt;
+
+    if (_position < _input.size() && _input[_position] == '.') {
+        ++_position;
+        if (!skip_digits())
+            return std::nullopt;
+    }
+
+    if (_position < _input.size() && (_input[_position] == 'e' || _input[_position] == 'E')) {
+        ++_position;
+        if (_position < _input.size() && (_input[_position] == '+' || _input[_position] == '-'))
+            ++_position;
+        if (!skip_digits())
+            return std::nullopt;
+    }
+
+    return _input.substr(begin, _position - begin);
+}
+
+bool JsonCursor::to_double(std::string_view number, double& value) {
+#if defined(__cpp_lib_to_chars)
+    const auto* end = number.data() + number.size();
+    const auto result = std::from_chars(number.data(), end, value);
+    return result.ec == std::errc() && result.ptr == end;
+#else
+    // strtod needs a terminated copy and the decimal point of the current locale
+    char buffer[64];
+    std::string long_number;
+    char* text = buffer;
+    if (number.size() >= sizeof(buffer)) {
+        long_number.assign(number);
+        text = long_number.data();
+    } else {
+        number.copy(buffer, number.size());
+        buffer[number.size()] = '\0';
+    }
+    const auto point = number.find('.');
+    if (point != std::string_view::npos)
+        text[point] = *std::localeconv()->decimal_point;
+
+    char* parsed = nullptr;
+    errno = 0;
+    value = std::strtod(text, &parsed);
+    if (parsed != text + number.size())
+        return false;
+    // Denormals are in range, as they are for std::from_chars
+    return errno != ERANGE || (!std::isinf(value) && value != 0);
+#endif
+}
+
+}
@@ -0,0 +1,128 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonLines.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Core {
+
+bool JsonLines::Completion::claim(std::size_t chunk) {
+    std::lock_guard lock(_mutex);
+    if (_claimed[chunk])
+        return false;
+    _claimed[chunk] = true;
+    return true;
+}
+
+void JsonLines::Completion::cancel(std::size_t count) {
+    {
+        std::lock_guard lock(_mutex);
+        for (std::size_t chunk = 0; chunk < count; ++chunk) {
+            if (!_claimed[chunk]) {
+                _claimed[chunk] = true;
+                ++_finished_count;
+            }
+        }
+    }
+    _finished.notify_all();
+}
+
+void JsonLines::Completion::finish(std::size_t chunk, std::vector<Json> records) {
+    {
+        std::lock_guard lock(_mutex);
+        _records[chunk] = std::move(records);
+        _done[chunk] = true;
+        _ready.push_back(chunk);
+        ++_finished_count;
+    }
+    _finished.notify_all();
+}
+
+void JsonLines::Completion::fail(std::size_t chunk, std::exception_ptr error) {
+    {
+        std::lock_guard lock(_mutex);
+        if (!_error)
+            _error = std::move(error);
+        _done[chunk] = true;
+        ++_finished_count;
+    }
+    _finished.notify_all();
+}
+
+std::vector<Json> JsonLines::Completion::take(std::size_t chunk) {
+    std::unique_lock lock(_mutex);
+    _finished.wait(lock, [this, chunk]() { return _done[chunk] || _error; });
+    if (_error)
+        std::rethrow_exception(_error);
+
+    _ready.erase(std::find(_ready.begin(), _ready.end(), chunk));
+    return std::move(_records[chunk]);
+}
+
+std::vector<Json> JsonLines::Completion::take_any() {
+    std::unique_lock lock(_mutex);
+    _finished.wait(lock, [this]() { return !_ready.empty() || _error; });
+    if (_error)
+        std::rethrow_exception(_error);
+
+    const auto chunk = _ready.front();
+    _ready.pop_front();
+    return std::move(_records[chunk]);
+}
+
+void JsonLines::Completion::wait(std::size_t count) {
+    std::unique_lock lock(_mutex);
+    _finished.wait(lock, [this, count]() { return _finished_count >= count; });
+}
+
+std::vector<std::string_view> JsonLines::split(std::string_view text, std::size_t chunk_size) {
+    std::vector<std::string_view> chunks;
+    std::size_t begin = 0;
+    while (begin < text.size()) {
+        auto end = text.size();
+        if (text.size() - begin > chunk_size) {
+            const auto line_end = text.find('\n', begin + std::max<std::size_t>(chunk_size, 1) - 1);
+            if (line_end != std::string_view::npos)
+                end = line_end + 1;
+        }
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+void JsonLines::parse(std::string_view chunk, std::vector<Json>& records) {
+    const auto* position = chunk.data();
+    const auto* end = position + chunk.size();
+    while (position < end) {
+        const auto* line_end = static_cast<const char*>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+        if (!line_end)
+            line_end = end;
+
+        const std::string_view line(position, static_cast<std::size_t>(line_end - position));
+        if (line.find_first_not_of(" \t\r") != std::string_view::npos)
+            records.push_back(Json::parse(line));
+        position = line_end + 1;
+    }
+}
+
+JsonLinesWriter& JsonLinesWriter::write(const Json& json) {
+    _writer.write(json).write_raw("\n");
+    if (_writer.buffer().size() >= _batch_size)
+        flush();
+    return *this;
+}
+
+void JsonLinesWriter::flush() {
+    const auto& lines = _writer.buffer();
+    if (lines.empty())
+        return;
+
+    _stream.write(lines.data(), static_cast<std::streamsize>(lines.size()));
+    _writer.clear();
+}
+
+}
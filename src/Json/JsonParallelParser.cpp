@@ -0,0 +1,95 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonParallelParser.hpp>
+#include <Json/JsonCursor.hpp>
+
+#include <cstring>
+
+namespace Core {
+
+namespace {
+
+/// \brief Position after the string starting at \param position (after its opening quote).
+/// \returns the size of the text if the string is not closed.
+std::size_t skip_string(std::string_view text, std::size_t position) {
+    while (position < text.size()) {
+        // Jump to the closing quote, stop at backslashes on the way
+        const auto* quote = static_cast<const char*>(std::memchr(text.data() + position, '"', text.size() - position));
+        if (!quote)
+            return text.size();
+
+        const auto end = static_cast<std::size_t>(quote - text.data());
+        const auto* backslash = static_cast<const char*>(std::memchr(text.data() + position, '\\', end - position));
+        if (!backslash)
+            return end + 1;
+        position = static_cast<std::size_t>(backslash - text.data()) + 2;
+    }
+    return text.size();
+}
+
+}
+
+std::optional<JsonParallelParser::Split> JsonParallelParser::split(std::string_view text, std::size_t chunk_size) {
+    JsonCursor cursor(text);
+    if (!cursor.consume('['))
+        return std::nullopt;
+
+    Split split;
+    auto chunk_begin = cursor.position();
+    std::size_t chunk_count = 1;
+    std::size_t depth = 0;
+    if (cursor.peek() == ']')
+        chunk_count = 0;
+
+    for (auto position = chunk_begin; position < text.size(); ++position) {
+        switch (text[position]) {
+            case '"':
+                position = skip_string(text, position + 1) - 1;
+                break;
+            case '[':
+            case '{':
+                ++depth;
+                break;
+            case ']':
+            case '}':
+                if (depth > 0) {
+                    --depth;
+                    break;
+                }
+                if (text[position] != ']')
+                    return std::nullopt;
+
+                if (chunk_count > 0) {
+                    split.chunks.push_back({text.substr(chunk_begin, position - chunk_begin), split.size, chunk_count});
+                    split.size += chunk_count;
+                }
+
+                // Only whitespace may follow the array
+                for (++position; position < text.size(); ++position) {
+                    if (!JsonCursor::is_whitespace(text[position]))
+                        return std::nullopt;
+                }
+                return split;
+            case ',':
+                if (depth > 0)
+                    break;
+
+                if (position - chunk_begin < chunk_size) {
+                    ++chunk_count;
+                    break;
+                }
+                split.chunks.push_back({text.substr(chunk_begin, position - chunk_begin), split.size, chunk_count});
+                split.size += chunk_count;
+                chunk_begin = position + 1;
+                chunk_count = 1;
+                break;
+            default:
+                break;
+        }
+    }
+    return std::nullopt;
+}
+
+}
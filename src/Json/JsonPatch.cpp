@@ -0,0 +1,433 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonPatch.hpp>
+
+#include <algorithm>
+
+#include <Utils/Utils.hpp>
+
+namespace Core {
+
+std::optional<JsonPatch::Pointer> JsonPatch::parse_pointer(std::string_view pointer) {
+    Pointer tokens;
+    if (pointer.empty())
+        return tokens;
+    if (pointer.front() != '/')
+        return std::nullopt;
+
+    for (std::size_t begin = 1;;) {
+        const auto end = std::min(pointer.find('/', begin), pointer.size());
+        auto& token = tokens.emplace_back();
+        for (auto i = begin; i < end; ++i) {
+            if (pointer[i] != '~') {
+                token += pointer[i];
+            } else if (i + 1 < end && (pointer[i + 1] == '0' || pointer[i + 1] == '1')) {
+                token += pointer[++i] == '0' ? '~' : '/';
+            } else {
+                return std::nullopt;
+            }
+        }
+
+        if (end == pointer.size())
+            return tokens;
+        begin = end + 1;
+    }
+}
+
+std::string JsonPatch::append_token(const std::string& pointer, std::string_view token) {
+    auto result = pointer + '/';
+    for (const auto character : token) {
+        if (character == '~')
+            result += "~0";
+        else if (character == '/')
+            result += "~1";
+        else
+            result += character;
+    }
+    return result;
+}
+
+std::optional<std::size_t> JsonPatch::parse_index(const std::string& token, std::size_t size, bool allow_end) {
+    if (token == "-")
+        return allow_end ? std::optional(size) : std::nullopt;
+    if (token.empty() || token.size() > 18 || (token.size() > 1 && token[0] == '0')
+        || !std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        return std::nullopt;
+
+    const auto index = static_cast<std::size_t>(std::stoull(token));
+    if (index > size || (index == size && !allow_end))
+        return std::nullopt;
+    return index;
+}
+
+Json::Value* JsonPatch::child(Json& container, const std::string& token) {
+    return visit_variant(container._data, [&token](Json::JsonObject& object) -> Json::Value* {
+        auto it = object.find(token);
+        return it != object.end() ? &it->second : nullptr;
+    }, [&token](Json::JsonArray& array) -> Json::Value* {
+        const auto index = parse_index(token, array.size(), false);
+        return index ? &array[*index] : nullptr;
+    });
+}
+
+Json* JsonPatch::parent(Json& document, const Pointer& pointer) {
+    Json* container = &document;
+    for (std::size_t i = 0; i + 1 < pointer.size(); ++i) {
+        auto* value = child(*container, pointer[i]);
+        if (!value || !value->is<Json>())
+            return nullptr;
+        container = &std::get<Json>(*value);
+    }
+    return container;
+}
+
+Json::Value* JsonPatch::find(Json& document, const Pointer& pointer) {
+    auto* container = pointer.empty() ? nullptr : parent(document, pointer);
+    return container ? child(*container, pointer.back()) : nullptr;
+}
+
+bool JsonPatch::add(Json& document, const Pointer& pointer, Json::Value&& value, UndoLog* undo) {
+    if (pointer.empty()) {
+        if (!value.is<Json>())
+            return false;
+        if (undo)
+            undo->push_back({Undo::Kind::Replace, pointer, Json::Value(std::move(document))});
+        document = std::move(std::get<Json>(value));
+        return true;
+    }
+
+    auto* container = parent(document, pointer);
+    if (!container)
+        return false;
+
+    const auto& token = pointer.back();
+    return visit_variant(container->_data, [&](Json::JsonObject& object) {
+        auto [member, inserted] = object.emplace(token, Json::Value());
+        if (undo && inserted)
+            undo->push_back({Undo::Kind::Remove, pointer, std::nullopt});
+        else if (undo)
+            undo->push_back({Undo::Kind::Replace, pointer, std::move(member->second)});
+        member->second = std::move(value);
+        return true;
+    }, [&](Json::JsonArray& array) {
+        const auto index = parse_index(token, array.size(), true);
+        if (!index)
+            return false;
+        array.insert(array.begin() + static_cast<std::ptrdiff_t>(*index), std::move(value));
+        if (undo) {
+            auto& step = undo->emplace_back(Undo{Undo::Kind::Remove, pointer, std::nullopt});
+            step.pointer.back() = std::to_string(*index);
+        }
+        return true;
+    });
+}
+
+std::optional<Json::Value> JsonPatch::remove(Json& document, const Pointer& pointer) {
+    auto* container = pointer.empty() ? nullptr : parent(document, pointer);
+    if (!container)
+        return std::nullopt;
+
+    const auto& token = pointer.back();
+    return visit_variant(container->_data, [&token](Json::JsonObject& object) -> std::optional<Json::Value> {
+        auto it = object.find(token);
+        if (it == object.end())
+            return std::nullopt;
+        std::optional<Json::Value> removed(std::in_place, std::move(it->second));
+        object.erase(token);
+        return removed;
+    }, [&token](Json::JsonArray& array) -> std::optional<Json::Value> {
+        const auto index = parse_index(token, array.size(), false);
+        if (!index)
+            return std::nullopt;
+        std::optional<Json::Value> removed(std::in_place, std::move(array[*index]));
+        array.erase(array.begin() + static_cast<std::ptrdiff_t>(*index));
+        return removed;
+    });
+}
+
+bool JsonPatch::replace(Json& document, const Pointer& pointer, Json::Value&& value, UndoLog& undo) {
+    if (pointer.empty())
+        return add(document, pointer, std::move(value), &undo);
+
+    auto* target = find(document, pointer);
+    if (!target)
+        return false;
+    undo.push_back({Undo::Kind::Replace, pointer, std::move(*target)});
+    *target = std::move(value);
+    return true;
+}
+
+bool JsonPatch::apply_operation(Json& document, const Json::Value& operation, UndoLog& undo) {
+    if (!operation.is<Json>())
+        return false;
+
+    const auto& members = std::get<Json>(operation);
+    const auto* op = members.get_if<std::string>("op");
+    const auto* path_text = members.get_if<std::string>("path");
+    if (!op || !path_text)
+        return false;
+
+    const auto path = parse_pointer(*path_text);
+    if (!path)
+        return false;
+
+    const auto* value = members.find("value");
+    if (*op == "add")
+        return value && add(document, *path, Json::Value(*value), &undo);
+    if (*op == "remove") {
+        auto removed = remove(document, *path);
+        if (!removed)
+            return false;
+        undo.push_back({Undo::Kind::Add, *path, std::move(removed)});
+        return true;
+    }
+    if (*op == "replace")
+        return value && replace(document, *path, Json::Value(*value), undo);
+    if (*op == "test") {
+        if (!value)
+            return false;
+        if (path->empty())
+            return value->is<Json>() && equal(document, std::get<Json>(*value));
+        const auto* current = find(document, *path);
+        return current && equal(*current, *value);
+    }
+
+    const auto* from_text = members.get_if<std::string>("from");
+    const auto from = from_text ? parse_pointer(*from_text) : std::nullopt;
+    if (!from)
+        return false;
+
+    if (*op == "copy") {
+        if (from->empty())
+            return add(document, *path, Json::Value(document), &undo);
+        const auto* source = find(document, *from);
+        return source && add(document, *path, Json::Value(*source), &undo);
+    }
+    if (*op == "move") {
+        // A value can not be moved into itself
+        if (from->size() < path->size() && std::equal(from->begin(), from->end(), path->begin()))
+            return false;
+        if (*from == *path)
+            return find(document, *from) != nullptr;
+
+        auto moved = remove(document, *from);
+        if (!moved)
+            return false;
+        if (add(document, *path, std::move(*moved), &undo)) {
+            // Reverting the add carries the value to the step putting it back
+            undo.insert(undo.end() - 1, Undo{Undo::Kind::Add, *from, std::nullopt});
+            return true;
+        }
+
+        // The value is only taken by a successful add, put it back
+        add(document, *from, std::move(*moved));
+        return false;
+    }
+    return false;
+}
+
+bool JsonPatch::apply(Json& document, const Json& patch) {
+    if (!patch.valid() || !std::holds_alternative<Json::JsonArray>(patch._data))
+        return false;
+
+    UndoLog undo;
+    for (const auto& operation : patch.elements()) {
+        if (!apply_operation(document, operation, undo)) {
+            rollback(document, undo);
+            return false;
+        }
+    }
+    return true;
+}
+
+void JsonPatch::rollback(Json& document, UndoLog& undo) {
+    std::optional<Json::Value> carried;
+    for (auto step = undo.rbegin(); step != undo.rend(); ++step) {
+        switch (step->kind) {
+            case Undo::Kind::Add:
+                add(document, step->pointer, std::move(step->value ? *step->value : *carried));
+                break;
+            case Undo::Kind::Remove:
+                carried = remove(document, step->pointer);
+                break;
+            case Undo::Kind::Replace:
+                if (step->pointer.empty()) {
+                    carried.emplace(std::move(document));
+                    document = std::move(std::get<Json>(*step->value));
+                } else {
+                    auto* target = find(document, step->pointer);
+                    carried.emplace(std::move(*target));
+                    *target = std::move(*step->value);
+                }
+                break;
+        }
+    }
+    undo.clear();
+}
+
+bool JsonPatch::equal(const Json& first, const Json& second) {
+    if (first._data.index() != second._data.index())
+        return false;
+
+    return visit_variant(first._data, [&second](const Json::JsonObject& object) {
+        const auto& other = std::get<Json::JsonObject>(second._data);
+        if (object.size() != other.size())
+            return false;
+        for (const auto& [key, value] : object) {
+            auto it = other.find(key);
+            if (it == other.end() || !equal(value, it->second))
+                return false;
+        }
+        return true;
+    }, [&second](const Json::JsonArray& array) {
+        const auto& other = std::get<Json::JsonArray>(second._data);
+        return array.size() == other.size()
+               && std::equal(array.begin(), array.end(), other.begin(), [](const auto& a, const auto& b) {
+                   return equal(a, b);
+               });
+    });
+}
+
+bool JsonPatch::equal(const Json::Value& first, const Json::Value& second) {
+    if (first.is<Json>() && second.is<Json>())
+        return equal(std::get<Json>(first), std::get<Json>(second));
+
+    // Numbers of different types, e.g. int and long or int and double, compare by value
+    const auto whole = [](const Json::Value& value) -> std::optional<long long> {
+        if (value.is<int>())
+            return std::get<int>(value);
+        if (value.is<long>())
+            return std::get<long>(value);
+        if (value.is<long long>())
+            return std::get<long long>(value);
+        return std::nullopt;
+    };
+    const auto first_whole = whole(first);
+    const auto second_whole = whole(second);
+    if (first_whole && second_whole)
+        return *first_whole == *second_whole;
+    if (first_whole && second.is<double>())
+        return static_cast<double>(*first_whole) == std::get<double>(second);
+    if (second_whole && first.is<double>())
+        return static_cast<double>(*second_whole) == std::get<double>(first);
+
+    return first.to_std_variant() == second.to_std_variant();
+}
+
+void JsonPatch::diff(const Json& from, const Json& to, const std::string& path, Json& patch) {
+    const auto operation = [&patch](const char* op, const std::string& path, const Json::Value* value) {
+        auto entry = Json::create_object();
+        entry["op"] = std::string(op);
+        entry["path"] = path;
+        if (value)
+            entry["value"] = *value;
+        patch.push_back(std::move(entry));
+    };
+
+    if (from._data.index() != to._data.index()) {
+        const Json::Value value(to);
+        operation("replace", path, &value);
+        return;
+    }
+
+    // The path is only built for containers and changed values
+    const auto diff_values = [&](const Json::Value& first, const Json::Value& second, const auto& at) {
+        if (first.is<Json>() && second.is<Json>())
+            diff(std::get<Json>(first), std::get<Json>(second), at(), patch);
+        else if (!equal(first, second))
+            operation("replace", at(), &second);
+    };
+
+    visit_variant(from._data, [&](const Json::JsonObject& object) {
+        const auto& other = std::get<Json::JsonObject>(to._data);
+        for (const auto& [key, value] : object) {
+            if (other.find(key) == other.end())
+                operation("remove", append_token(path, key), nullptr);
+        }
+        for (const auto& [key, value] : other) {
+            auto it = object.find(key);
+            if (it == object.end())
+                operation("add", append_token(path, key), &value);
+            else
+                diff_values(it->second, value, [&path, &key = key]() { return append_token(path, key); });
+        }
+    }, [&](const Json::JsonArray& array) {
+        const auto& other = std::get<Json::JsonArray>(to._data);
+        const auto common = std::min(array.size(), other.size());
+        for (std::size_t i = 0; i < common; ++i)
+            diff_values(array[i], other[i], [&path, i]() { return path + '/' + std::to_string(i); });
+        for (auto i = common; i < other.size(); ++i)
+            operation("add", path + "/-", &other[i]);
+        // Removed from the back so the indexes stay valid
+        for (auto i = array.size(); i > common; --i)
+            operation("remove", path + '/' + std::to_string(i - 1), nullptr);
+    });
+}
+
+Json JsonPatch::diff(const Json& from, const Json& to) {
+    auto patch = Json::create_array();
+    diff(from, to, "", patch);
+    return patch;
+}
+
+void JsonPatch::merge(Json::Value& target, const Json::Value& patch) {
+    if (!patch.is<Json>() || !std::holds_alternative<Json::JsonObject>(std::get<Json>(patch)._data)) {
+        target = patch;
+        return;
+    }
+
+    if (!target.is<Json>() || !std::holds_alternative<Json::JsonObject>(std::get<Json>(target)._data))
+        target = Json::create_object();
+    merge(std::get<Json>(target), std::get<Json>(patch));
+}
+
+void JsonPatch::merge(Json& target, const Json& patch) {
+    if (!std::holds_alternative<Json::JsonObject>(patch._data)) {
+        target = patch;
+        return;
+    }
+    if (!std::holds_alternative<Json::JsonObject>(target._data))
+        target = Json::create_object();
+
+    auto& object = std::get<Json::JsonObject>(target._data);
+    for (const auto& [key, value] : std::get<Json::JsonObject>(patch._data)) {
+        if (value.is<Json::Null>())
+            object.erase(key);
+        else
+            merge(object[key], value);
+    }
+}
+
+Json JsonPatch::merge_diff_object(const Json& from, const Json& to) {
+    auto patch = Json::create_object();
+    const auto& object = std::get<Json::JsonObject>(from._data);
+    const auto& other = std::get<Json::JsonObject>(to._data);
+    for (const auto& [key, value] : object) {
+        if (other.find(key) == other.end())
+            patch[key] = Json::Null();
+    }
+
+    const auto is_object = [](const Json::Value& value) {
+        return value.is<Json>() && std::holds_alternative<Json::JsonObject>(std::get<Json>(value)._data);
+    };
+    for (const auto& [key, value] : other) {
+        auto it = object.find(key);
+        if (it != object.end() && equal(it->second, value))
+            continue;
+        if (it != object.end() && is_object(it->second) && is_object(value))
+            patch[key] = merge_diff_object(std::get<Json>(it->second), std::get<Json>(value));
+        else
+            patch[key] = value;
+    }
+    return patch;
+}
+
+Json JsonPatch::merge_diff(const Json& from, const Json& to) {
+    if (!std::holds_alternative<Json::JsonObject>(from._data) || !std::holds_alternative<Json::JsonObject>(to._data))
+        return to;
+    return merge_diff_object(from, to);
+}
+
+}
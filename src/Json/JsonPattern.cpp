@@ -0,0 +1,544 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonPattern.hpp>
+
+#include <limits>
+
+namespace Core {
+
+namespace {
+/// \brief Repetition counts and program sizes above these are refused.
+constexpr std::uint32_t max_repetitions = 1000;
+constexpr std::size_t max_program = 1 << 16;
+
+constexpr auto unbounded = std::numeric_limits<std::uint32_t>::max();
+
+std::bitset<256> range(unsigned char first, unsigned char last) {
+    std::bitset<256> result;
+    for (unsigned c = first; c <= last; ++c)
+        result.set(c);
+    return result;
+}
+
+std::bitset<256> digits() {
+    return range('0', '9');
+}
+
+std::bitset<256> word() {
+    return range('a', 'z') | range('A', 'Z') | digits() | range('_', '_');
+}
+
+std::bitset<256> space() {
+    return range('\t', '\r') | range(' ', ' ');
+}
+
+bool is_word(std::string_view text, std::size_t position) {
+    static const auto characters = word();
+    return position < text.size() && characters.test(static_cast<unsigned char>(text[position]));
+}
+}
+
+/// \brief Syntax tree of a pattern.
+struct JsonPattern::Node {
+    enum class Kind {
+        Empty,
+        Byte,
+        Class,
+        Begin,
+        End,
+        WordBoundary,
+        NotWordBoundary,
+        Concat,
+        Alternate,
+        Repeat
+    };
+
+    Kind kind = Kind::Empty;
+    unsigned char byte = 0;
+    std::uint32_t class_index = 0;
+    std::uint32_t min = 0, max = 0;
+    std::vector<Node> children;
+};
+
+/// \brief Recursive descent parser of the supported syntax.
+/// Every method \returns false on syntax it does not support, malformed or not.
+class JsonPattern::Parser {
+private:
+    std::string_view _pattern;
+    std::size_t _position = 0;
+    std::vector<std::bitset<256>>& _classes;
+
+    bool at_end() const {
+        return _position == _pattern.size();
+    }
+
+    bool consume(char c) {
+        if (at_end() || _pattern[_position] != c)
+            return false;
+        ++_position;
+        return true;
+    }
+
+    Node class_node(const std::bitset<256>& members) {
+        Node node;
+        node.kind = Node::Kind::Class;
+        node.class_index = static_cast<std::uint32_t>(_classes.size());
+        _classes.push_back(members);
+        return node;
+    }
+
+    static Node byte_node(unsigned char byte) {
+        Node node;
+        node.kind = Node::Kind::Byte;
+        node.byte = byte;
+        return node;
+    }
+
+    /// \brief Read \param count hexadecimal digits into \param value.
+    bool hex(std::size_t count, unsigned& value) {
+        value = 0;
+        for (std::size_t i = 0; i < count; ++i, ++_position) {
+            if (at_end())
+                return false;
+            const auto c = _pattern[_position];
+            value <<= 4;
+            if (c >= '0' && c <= '9')
+                value |= static_cast<unsigned>(c - '0');
+            else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+                value |= static_cast<unsigned>((c | 0x20) - 'a' + 10);
+            else
+                return false;
+        }
+        return true;
+    }
+
+    /// \brief The escape after the backslash as a set of bytes, \param single tells
+    /// if it is a single character. Escapes of more than a byte are not supported.
+    bool escape(std::bitset<256>& members, bool& single) {
+        if (at_end())
+            return false;
+
+        single = false;
+        const auto c = _pattern[_position++];
+        switch (c) {
+            case 'd':
+                members = digits();
+                return true;
+            case 'D':
+                members = ~digits();
+                return true;
+            case 'w':
+                members = word();
+                return true;
+            case 'W':
+                members = ~word();
+                return true;
+            case 's':
+                members = space();
+                return true;
+            case 'S':
+                members = ~space();
+                return true;
+            default:
+                break;
+        }
+
+        single = true;
+        unsigned value = 0;
+        switch (c) {
+            case 't':
+                value = '\t';
+                break;
+            case 'n':
+                value = '\n';
+                break;
+            case 'r':
+                value = '\r';
+                break;
+            case 'f':
+                value = '\f';
+                break;
+            case 'v':
+                value = '\v';
+                break;
+            case '0':
+                // \0 followed by a digit would be an octal or a backreference
+                if (!at_end() && _pattern[_position] >= '0' && _pattern[_position] <= '9')
+                    return false;
+                value = 0;
+                break;
+            case 'x':
+                if (!hex(2, value))
+                    return false;
+                break;
+            case 'u':
+                if (!hex(4, value) || value > 0x7F)
+                    return false;
+                break;
+            default:
+                // Letters and digits are other escapes (backreferences, \c, \k ...)
+                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+                    return false;
+                value = static_cast<unsigned char>(c);
+                break;
+        }
+        members.reset();
+        members.set(value);
+        return true;
+    }
+
+    /// \brief A class, after its opening bracket.
+    bool character_class(Node& node) {
+        const auto negated = consume('^');
+        std::bitset<256> members;
+        while (!consume(']')) {
+            if (at_end())
+                return false;
+
+            std::bitset<256> first;
+            bool single = true;
+            if (consume('\\')) {
+                if (consume('b'))
+                    first.set('\b');
+                else if (!escape(first, single))
+                    return false;
+            } else {
+                first.set(static_cast<unsigned char>(_pattern[_position++]));
+            }
+
+            // A range, unless the dash is the last character of the class
+            if (single && _position + 1 < _pattern.size() && _pattern[_position] == '-' && _pattern[_position + 1] != ']') {
+                ++_position;
+                std::bitset<256> last;
+                if (consume('\\')) {
+                    if (!escape(last, single) || !single)
+                        return false;
+                } else {
+                    last.set(static_cast<unsigned char>(_pattern[_position++]));
+                }
+
+                unsigned low = 0, high = 0;
+                while (!first.test(low))
+                    ++low;
+                while (!last.test(high))
+                    ++high;
+                if (low > high)
+                    return false;
+                members |= range(static_cast<unsigned char>(low), static_cast<unsigned char>(high));
+            } else {
+                members |= first;
+            }
+        }
+        node = class_node(negated ? ~members : members);
+        return true;
+    }
+
+    bool atom(Node& node) {
+        const auto c = _pattern[_position++];
+        switch (c) {
+            case '(': {
+                // Only non-capturing groups of the (? forms, lookarounds need backtracking
+                if (consume('?') && !consume(':'))
+                    return false;
+                if (!alternation(node) || !consume(')'))
+                    return false;
+                return true;
+            }
+            case '[':
+                return character_class(node);
+            case '.':
+                node = class_node(~(range('\n', '\n') | range('\r', '\r')));
+                return true;
+            case '^':
+                node.kind = Node::Kind::Begin;
+                return true;
+            case '$':
+                node.kind = Node::Kind::End;
+                return true;
+            case '\\': {
+                if (consume('b')) {
+                    node.kind = Node::Kind::WordBoundary;
+                    return true;
+                }
+                if (consume('B')) {
+                    node.kind = Node::Kind::NotWordBoundary;
+                    return true;
+                }
+                std::bitset<256> members;
+                bool single = false;
+                if (!escape(members, single))
+                    return false;
+                if (!single) {
+                    node = class_node(members);
+                    return true;
+                }
+                unsigned byte = 0;
+                while (!members.test(byte))
+                    ++byte;
+                node = byte_node(static_cast<unsigned char>(byte));
+                return true;
+            }
+            case ')':
+            case '{':
+            case '*':
+            case '+':
+            case '?':
+            case '|':
+                return false;
+            default:
+                node = byte_node(static_cast<unsigned char>(c));
+                return true;
+        }
+    }
+
+    /// \brief A decimal count of a {n,m} quantifier.
+    bool count(std::uint32_t& value) {
+        const auto begin = _position;
+        value = 0;
+        while (!at_end() && _pattern[_position] >= '0' && _pattern[_position] <= '9') {
+            value = value * 10 + static_cast<std::uint32_t>(_pattern[_position++] - '0');
+            if (value > max_repetitions)
+                return false;
+        }
+        return _position != begin;
+    }
+
+    bool quantifier(Node& node) {
+        std::uint32_t min = 0, max = unbounded;
+        if (consume('*')) {
+        } else if (consume('+')) {
+            min = 1;
+        } else if (consume('?')) {
+            max = 1;
+        } else if (consume('{')) {
+            if (!count(min))
+                return false;
+            max = min;
+            if (consume(',')) {
+                max = unbounded;
+                if (!at_end() && _pattern[_position] != '}' && (!count(max) || max < min))
+                    return false;
+            }
+            if (!consume('}'))
+                return false;
+        } else {
+            return true;
+        }
+        // Laziness does not change whether there is a match
+        consume('?');
+
+        const auto kind = node.kind;
+        if (kind == Node::Kind::Begin || kind == Node::Kind::End || kind == Node::Kind::WordBoundary
+            || kind == Node::Kind::NotWordBoundary)
+            return false;
+
+        Node repeat;
+        repeat.kind = Node::Kind::Repeat;
+        repeat.min = min;
+        repeat.max = max;
+        repeat.children.push_back(std::move(node));
+        node = std::move(repeat);
+        return true;
+    }
+
+    bool sequence(Node& node) {
+        node.kind = Node::Kind::Concat;
+        while (!at_end() && _pattern[_position] != '|' && _pattern[_position] != ')') {
+            auto& child = node.children.emplace_back();
+            if (!atom(child) || !quantifier(child))
+                return false;
+        }
+        return true;
+    }
+
+public:
+    Parser(std::string_view pattern, std::vector<std::bitset<256>>& classes) : _pattern(pattern), _classes(classes) {}
+
+    bool alternation(Node& node) {
+        if (!sequence(node))
+            return false;
+        if (at_end() || _pattern[_position] != '|')
+            return true;
+
+        Node alternatives;
+        alternatives.kind = Node::Kind::Alternate;
+        alternatives.children.push_back(std::move(node));
+        while (consume('|')) {
+            if (!sequence(alternatives.children.emplace_back()))
+                return false;
+        }
+        node = std::move(alternatives);
+        return true;
+    }
+
+    bool parse(Node& node) {
+        return alternation(node) && at_end();
+    }
+};
+
+void JsonPattern::emit(const Node& node) {
+    using Op = Instruction::Op;
+    const auto here = [this]() {
+        return static_cast<std::uint32_t>(_program.size());
+    };
+
+    switch (node.kind) {
+        case Node::Kind::Empty:
+            break;
+        case Node::Kind::Byte:
+            _program.push_back({Op::Byte, node.byte});
+            break;
+        case Node::Kind::Class:
+            _program.push_back({Op::Class, 0, node.class_index});
+            break;
+        case Node::Kind::Begin:
+            _program.push_back({Op::Begin});
+            break;
+        case Node::Kind::End:
+            _program.push_back({Op::End});
+            break;
+        case Node::Kind::WordBoundary:
+            _program.push_back({Op::WordBoundary});
+            break;
+        case Node::Kind::NotWordBoundary:
+            _program.push_back({Op::NotWordBoundary});
+            break;
+        case Node::Kind::Concat:
+            for (const auto& child : node.children)
+                emit(child);
+            break;
+        case Node::Kind::Alternate: {
+            // Split to the alternative or the next split, every alternative jumps to the end
+            std::vector<std::uint32_t> jumps;
+            for (std::size_t i = 0; i < node.children.size(); ++i) {
+                const auto split = here();
+                if (i + 1 < node.children.size())
+                    _program.push_back({Op::Split, 0, split + 1});
+                emit(node.children[i]);
+                if (i + 1 < node.children.size()) {
+                    jumps.push_back(here());
+                    _program.push_back({Op::Jump});
+                    _program[split].second = here();
+                }
+            }
+            for (const auto jump : jumps)
+                _program[jump].first = here();
+            break;
+        }
+        case Node::Kind::Repeat: {
+            const auto& child = node.children.front();
+            for (std::uint32_t i = 0; i < node.min && _program.size() <= max_program; ++i)
+                emit(child);
+
+            if (node.max == unbounded) {
+                const auto loop = here();
+                _program.push_back({Op::Split, 0, loop + 1});
+                emit(child);
+                _program.push_back({Op::Jump, 0, loop});
+                _program[loop].second = here();
+                break;
+            }
+
+            // Each optional copy may be skipped to the end
+            std::vector<std::uint32_t> splits;
+            for (auto i = node.min; i < node.max && _program.size() <= max_program; ++i) {
+                splits.push_back(here());
+                _program.push_back({Op::Split, 0, here() + 1});
+                emit(child);
+            }
+            for (const auto split : splits)
+                _program[split].second = here();
+            break;
+        }
+    }
+}
+
+std::optional<JsonPattern> JsonPattern::compile(std::string_view pattern) {
+    JsonPattern result;
+    Node root;
+    if (!Parser(pattern, result._classes).parse(root))
+        return std::nullopt;
+    result.emit(root);
+    result._program.push_back({Instruction::Op::Match});
+    if (result._program.size() > max_program)
+        return std::nullopt;
+    return result;
+}
+
+bool JsonPattern::follow(std::vector<std::uint32_t>& threads, std::uint32_t pc, std::string_view text,
+                         std::size_t position, std::vector<std::size_t>& visited,
+                         std::vector<std::uint32_t>& stack) const {
+    using Op = Instruction::Op;
+
+    // Threads are marked with the position they were added at, each is followed once per position
+    stack.push_back(pc);
+    while (!stack.empty()) {
+        pc = stack.back();
+        stack.pop_back();
+        if (visited[pc] == position + 1)
+            continue;
+        visited[pc] = position + 1;
+
+        const auto& instruction = _program[pc];
+        switch (instruction.op) {
+            case Op::Byte:
+            case Op::Class:
+                threads.push_back(pc);
+                break;
+            case Op::Split:
+                stack.push_back(instruction.second);
+                stack.push_back(instruction.first);
+                break;
+            case Op::Jump:
+                stack.push_back(instruction.first);
+                break;
+            case Op::Begin:
+                if (position == 0)
+                    stack.push_back(pc + 1);
+                break;
+            case Op::End:
+                if (position == text.size())
+                    stack.push_back(pc + 1);
+                break;
+            case Op::WordBoundary:
+            case Op::NotWordBoundary: {
+                const auto boundary = (position > 0 && is_word(text, position - 1)) != is_word(text, position);
+                if (boundary == (instruction.op == Op::WordBoundary))
+                    stack.push_back(pc + 1);
+                break;
+            }
+            case Op::Match:
+                stack.clear();
+                return true;
+        }
+    }
+    return false;
+}
+
+bool JsonPattern::search(std::string_view text) const {
+    std::vector<std::uint32_t> current, next, stack;
+    std::vector<std::size_t> visited(_program.size(), 0);
+
+    // A new thread starts at every position, as the pattern may match anywhere
+    if (follow(current, 0, text, 0, visited, stack))
+        return true;
+    for (std::size_t position = 0; position < text.size(); ++position) {
+        const auto byte = static_cast<unsigned char>(text[position]);
+        next.clear();
+        for (const auto pc : current) {
+            const auto& instruction = _program[pc];
+            const auto matches = instruction.op == Instruction::Op::Byte ? instruction.byte == byte
+                                                                         : _classes[instruction.first].test(byte);
+            if (matches && follow(next, pc + 1, text, position + 1, visited, stack))
+                return true;
+        }
+        if (follow(next, 0, text, position + 1, visited, stack))
+            return true;
+        std::swap(current, next);
+    }
+    return false;
+}
+
+}
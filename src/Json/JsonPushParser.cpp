@@ -0,0 +1,63 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonPushParser.hpp>
+
+namespace Core {
+
+JsonPushParser::Status JsonPushParser::feed(std::string_view chunk) {
+    _consumed = 0;
+    if (_status == Status::Error)
+        return _status;
+
+    if (_status == Status::Complete) {
+        _document.reset();
+        _builder.reset();
+        _parser.reset();
+        _status = Status::NeedsMore;
+    }
+
+    const auto before = _parser.offset();
+    if (_parser.feed(chunk)) {
+        _consumed = chunk.size();
+        return _status;
+    }
+
+    // The builder stops the parser at the closing bracket of the document
+    if (_parser.stopped() && _builder.complete()) {
+        const auto document_size = _parser.offset() + 1;
+        _consumed = document_size - before;
+        _offset += document_size;
+        _document = _builder.take();
+        _status = Status::Complete;
+        return _status;
+    }
+
+    _consumed = _parser.offset() - before;
+    _status = Status::Error;
+    return _status;
+}
+
+std::size_t JsonPushParser::offset() const {
+    if (_status == Status::Complete)
+        return _offset;
+    return _offset + _parser.offset();
+}
+
+std::optional<Json> JsonPushParser::take() {
+    auto document = std::move(_document);
+    _document.reset();
+    return document;
+}
+
+void JsonPushParser::reset() {
+    _builder.reset();
+    _parser.reset();
+    _status = Status::NeedsMore;
+    _consumed = 0;
+    _offset = 0;
+    _document.reset();
+}
+
+}
@@ -0,0 +1,376 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonSaxParser.hpp>
+#include <Json/JsonCursor.hpp>
+
+namespace Core {
+
+namespace {
+bool is_digit(char character) {
+    return character >= '0' && character <= '9';
+}
+
+bool is_hex_digit(char character) {
+    return is_digit(character) || (character >= 'a' && character <= 'f') || (character >= 'A' && character <= 'F');
+}
+}
+
+bool JsonSaxParser::fail(std::size_t position) {
+    _state = State::Failed;
+    _error_offset = _offset + position;
+    return false;
+}
+
+bool JsonSaxParser::stop(bool proceed, std::size_t position) {
+    if (!proceed) {
+        _state = State::Stopped;
+        _error_offset = _offset + position;
+    }
+    return proceed;
+}
+
+bool JsonSaxParser::open(char container, std::size_t position) {
+    if (_containers.size() >= max_depth)
+        return fail(position);
+
+    _containers.push_back(container);
+    if (container == '{') {
+        _state = State::FirstKey;
+        return stop(_handler.on_object_begin(), position);
+    }
+    _state = State::FirstValue;
+    return stop(_handler.on_array_begin(), position);
+}
+
+bool JsonSaxParser::close(char bracket, std::size_t position) {
+    const auto container = bracket == '}' ? '{' : '[';
+    if (_containers.empty() || _containers.back() != container)
+        return fail(position);
+
+    _containers.pop_back();
+    if (!stop(container == '{' ? _handler.on_object_end() : _handler.on_array_end(), position))
+        return false;
+    return end_value();
+}
+
+bool JsonSaxParser::end_value() {
+    _state = _containers.empty() ? State::Done : State::Separator;
+    return true;
+}
+
+bool JsonSaxParser::begin_value(char character, std::size_t position) {
+    switch (character) {
+        case '{':
+        case '[':
+            return open(character, position);
+        case '"':
+            _state = State::String;
+            _string_state = StringState::Plain;
+            _string_escaped = false;
+            _is_key = false;
+            _token_begin = position + 1;
+            _token_continued = false;
+            return true;
+        case 't':
+            _literal = "true";
+            break;
+        case 'f':
+            _literal = "false";
+            break;
+        case 'n':
+            _literal = "null";
+            break;
+        default:
+            if (character != '-' && !is_digit(character))
+                return fail(position);
+
+            _state = State::Number;
+            _number_state = character == '-' ? NumberState::Sign
+                                             : character == '0' ? NumberState::Zero : NumberState::Integer;
+            _token_begin = position;
+            _token_continued = false;
+            return true;
+    }
+
+    _state = State::Literal;
+    _literal_matched = 1;
+    return true;
+}
+
+std::string_view JsonSaxParser::token(std::string_view chunk, std::size_t end) {
+    const auto piece = chunk.substr(_token_begin, end - _token_begin);
+    if (!_token_continued)
+        return piece;
+
+    // The token started in a previous chunk, it is completed in the buffer
+    _token.append(piece);
+    return _token;
+}
+
+bool JsonSaxParser::read_string(std::string_view chunk, std::size_t &position) {
+    while (position < chunk.size()) {
+        const auto character = chunk[position];
+        switch (_string_state) {
+            case StringState::Plain:
+                if (character == '"') {
+                    auto value = token(chunk, position);
+                    if (_string_escaped) {
+                        _unescaped.clear();
+                        JsonCursor::unescape(value, _unescaped);
+                        value = _unescaped;
+                    }
+                    const auto proceed = _is_key ? _handler.on_key(value) : _handler.on_string(value);
+                    if (!stop(proceed, position))
+                        return false;
+
+                    ++position;
+                    if (_is_key)
+                        _state = State::Colon;
+                    else
+                        end_value();
+                    return true;
+                }
+                if (static_cast<unsigned char>(character) < 0x20)
+                    return fail(position);
+                if (character == '\\') {
+                    _string_state = StringState::Escape;
+                    _string_escaped = true;
+                }
+                break;
+            case StringState::Escape:
+                switch (character) {
+                    case '"':
+                    case '\\':
+                    case '/':
+                    case 'b':
+                    case 'f':
+                    case 'n':
+                    case 'r':
+                    case 't':
+                        _string_state = StringState::Plain;
+                        break;
+                    case 'u':
+                        _string_state = StringState::Unicode;
+                        _unicode_remaining = 4;
+                        break;
+                    default:
+                        return fail(position);
+                }
+                break;
+            case StringState::Unicode:
+                if (!is_hex_digit(character))
+                    return fail(position);
+                if (--_unicode_remaining == 0)
+                    _string_state = StringState::Plain;
+                break;
+        }
+        ++position;
+    }
+    return true;
+}
+
+bool JsonSaxParser::read_number(std::string_view chunk, std::size_t &position) {
+    for (; position < chunk.size(); ++position) {
+        const auto character = chunk[position];
+        const auto digit = is_digit(character);
+        const auto exponent = character == 'e' || character == 'E';
+        switch (_number_state) {
+            case NumberState::Sign:
+                if (!digit)
+                    return fail(position);
+                _number_state = character == '0' ? NumberState::Zero : NumberState::Integer;
+                continue;
+            case NumberState::Zero:
+            case NumberState::Integer:
+                if (digit && _number_state == NumberState::Integer)
+                    continue;
+                if (character == '.') {
+                    _number_state = NumberState::Point;
+                    continue;
+                }
+                if (exponent) {
+                    _number_state = NumberState::Exponent;
+                    continue;
+                }
+                break;
+            case NumberState::Point:
+                if (!digit)
+                    return fail(position);
+                _number_state = NumberState::Fraction;
+                continue;
+            case NumberState::Fraction:
+                if (digit)
+                    continue;
+                if (exponent) {
+                    _number_state = NumberState::Exponent;
+                    continue;
+                }
+                break;
+            case NumberState::Exponent:
+                if (character == '+' || character == '-') {
+                    _number_state = NumberState::ExponentSign;
+                    continue;
+                }
+                [[fallthrough]];
+            case NumberState::ExponentSign:
+                if (!digit)
+                    return fail(position);
+                _number_state = NumberState::ExponentDigits;
+                continue;
+            case NumberState::ExponentDigits:
+                if (digit)
+                    continue;
+                break;
+        }
+
+        // The number ends before the current character, which is left to the next state
+        if (!stop(_handler.on_number(token(chunk, position)), position))
+            return false;
+        return end_value();
+    }
+    return true;
+}
+
+bool JsonSaxParser::read_literal(std::string_view chunk, std::size_t &position) {
+    for (; position < chunk.size() && _literal_matched < _literal.size(); ++position, ++_literal_matched) {
+        if (chunk[position] != _literal[_literal_matched])
+            return fail(position);
+    }
+
+    if (_literal_matched < _literal.size())
+        return true;
+
+    const auto proceed = _literal == "null" ? _handler.on_null() : _handler.on_bool(_literal == "true");
+    if (!stop(proceed, position))
+        return false;
+    return end_value();
+}
+
+bool JsonSaxParser::feed(std::string_view chunk) {
+    std::size_t position = 0;
+    if (_state == State::String || _state == State::Number)
+        _token_begin = 0;
+
+    while (position < chunk.size()) {
+        if (_state == State::Failed || _state == State::Stopped)
+            return false;
+
+        bool proceed = true;
+        const auto character = chunk[position];
+        switch (_state) {
+            case State::String:
+                if (!read_string(chunk, position))
+                    return false;
+                continue;
+            case State::Number:
+                if (!read_number(chunk, position))
+                    return false;
+                continue;
+            case State::Literal:
+                if (!read_literal(chunk, position))
+                    return false;
+                continue;
+            default:
+                break;
+        }
+
+        if (JsonCursor::is_whitespace(character)) {
+            ++position;
+            continue;
+        }
+
+        switch (_state) {
+            case State::Start:
+                proceed = character == '{' || character == '[' ? open(character, position) : fail(position);
+                break;
+            case State::FirstKey:
+            case State::Key:
+                if (character == '}' && _state == State::FirstKey) {
+                    proceed = close('}', position);
+                } else if (character == '"') {
+                    _state = State::String;
+                    _string_state = StringState::Plain;
+                    _string_escaped = false;
+                    _is_key = true;
+                    _token_begin = position + 1;
+                    _token_continued = false;
+                } else {
+                    proceed = fail(position);
+                }
+                break;
+            case State::Colon:
+                if (character == ':')
+                    _state = State::Value;
+                else
+                    proceed = fail(position);
+                break;
+            case State::FirstValue:
+            case State::Value:
+                proceed = character == ']' && _state == State::FirstValue ? close(']', position)
+                                                                           : begin_value(character, position);
+                break;
+            case State::Separator:
+                if (character == ',')
+                    _state = _containers.back() == '{' ? State::Key : State::Value;
+                else if (character == '}' || character == ']')
+                    proceed = close(character, position);
+                else
+                    proceed = fail(position);
+                break;
+            default:
+                proceed = fail(position);
+                break;
+        }
+
+        if (!proceed)
+            return false;
+        ++position;
+    }
+
+    if (_state == State::Failed || _state == State::Stopped)
+        return false;
+
+    // Keep the unfinished token for the next chunk
+    if (_state == State::String || _state == State::Number) {
+        if (!_token_continued)
+            _token.clear();
+        _token.append(chunk.substr(_token_begin));
+        _token_continued = true;
+    }
+    _offset += chunk.size();
+    return true;
+}
+
+bool JsonSaxParser::finish() {
+    if (_state == State::Failed || _state == State::Stopped)
+        return false;
+    if (_state != State::Done)
+        return fail(0);
+    return true;
+}
+
+void JsonSaxParser::reset() {
+    _state = State::Start;
+    _containers.clear();
+    _token.clear();
+    _token_continued = false;
+    _offset = 0;
+    _error_offset = 0;
+}
+
+bool JsonSaxParser::parse(std::istream &stream, IJsonHandler &handler, std::size_t chunk_size) {
+    JsonSaxParser parser(handler);
+    std::string buffer(chunk_size > 0 ? chunk_size : 1, '\0');
+
+    while (stream) {
+        stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto count = static_cast<std::size_t>(stream.gcount());
+        if (count > 0 && !parser.feed(std::string_view(buffer.data(), count)))
+            return false;
+    }
+    return parser.finish();
+}
+
+}
@@ -0,0 +1,676 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonSchema.hpp>
+#include <Json/JsonCursor.hpp>
+#include <Json/JsonPatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core {
+
+namespace {
+
+/// \brief Store \param message in \param error, the path is prepended while the error is returned.
+bool fail(JsonSchema::Error* error, std::string message) {
+    if (error) {
+        error->path.clear();
+        error->message = std::move(message);
+    }
+    return false;
+}
+
+/// \brief Prepend \param token to the path of \param error.
+bool fail_at(JsonSchema::Error* error, std::string_view token) {
+    if (error)
+        error->path = JsonPatch::append_token(std::string(), token) + error->path;
+    return false;
+}
+
+bool fail_at(JsonSchema::Error* error, std::size_t index) {
+    return fail_at(error, std::to_string(index));
+}
+
+/// \brief Number of code points in the UTF-8 \param text.
+std::size_t code_points(std::string_view text) {
+    return static_cast<std::size_t>(std::count_if(text.begin(), text.end(), [](char character) {
+        return (static_cast<unsigned char>(character) & 0xC0) != 0x80;
+    }));
+}
+
+}
+
+JsonSchema::JsonSchema(const Json& schema) {
+    _nodes.resize(2);
+    _nodes[reject_all].types = 0;
+    if (!schema.valid() || !std::holds_alternative<Json::JsonObject>(schema._data))
+        return;
+
+    Compiler compiler{schema, {}};
+    const auto root = compile_object(compiler, schema, "");
+    if (!root)
+        return;
+    _root = *root;
+    _valid = true;
+}
+
+std::optional<double> JsonSchema::number(const Json::Value& value) {
+    if (value.is<int>())
+        return std::get<int>(value);
+    if (value.is<long>())
+        return static_cast<double>(std::get<long>(value));
+    if (value.is<long long>())
+        return static_cast<double>(std::get<long long>(value));
+    if (value.is<double>())
+        return std::get<double>(value);
+    return std::nullopt;
+}
+
+std::optional<std::size_t> JsonSchema::count(const Json::Value& value) {
+    const auto result = number(value);
+    if (!result || *result < 0 || *result != std::floor(*result))
+        return std::nullopt;
+    return static_cast<std::size_t>(*result);
+}
+
+std::optional<JsonPattern> JsonSchema::regex(const Json::Value& value) {
+    if (!value.is<std::string>())
+        return std::nullopt;
+    return JsonPattern::compile(std::get<std::string>(value));
+}
+
+std::optional<std::size_t> JsonSchema::compile(Compiler& compiler, const Json::Value& schema, const std::string& pointer) {
+    if (schema.is<bool>())
+        return std::get<bool>(schema) ? accept_all : reject_all;
+    if (!schema.is<Json>() || !std::holds_alternative<Json::JsonObject>(std::get<Json>(schema)._data))
+        return std::nullopt;
+    return compile_object(compiler, std::get<Json>(schema), pointer);
+}
+
+std::optional<std::size_t> JsonSchema::compile_reference(Compiler& compiler, const std::string& reference) {
+    // Only references into this schema are resolved
+    if (reference.empty() || reference[0] != '#')
+        return std::nullopt;
+    const auto pointer = reference.substr(1);
+    if (pointer.empty())
+        return compile_object(compiler, compiler.root, pointer);
+
+    const auto tokens = JsonPatch::parse_pointer(pointer);
+    if (!tokens)
+        return std::nullopt;
+
+    const Json* container = &compiler.root;
+    const Json::Value* target = nullptr;
+    for (const auto& token : *tokens) {
+        if (!container)
+            return std::nullopt;
+        target = visit_variant(container->_data, [&token](const Json::JsonObject& object) -> const Json::Value* {
+            auto it = object.find(token);
+            return it != object.end() ? &it->second : nullptr;
+        }, [&token](const Json::JsonArray& array) -> const Json::Value* {
+            const auto index = JsonPatch::parse_index(token, array.size(), false);
+            return index ? &array[*index] : nullptr;
+        });
+        if (!target)
+            return std::nullopt;
+        container = target->is<Json>() ? &std::get<Json>(*target) : nullptr;
+    }
+    return compile(compiler, *target, pointer);
+}
+
+std::optional<std::size_t> JsonSchema::compile_object(Compiler& compiler, const Json& schema, const std::string& pointer) {
+    // The node is registered before its subschemas are compiled, so they can refer to it
+    static constexpr auto in_progress = static_cast<std::size_t>(-1);
+    if (const auto it = compiler.compiled.find(pointer); it != compiler.compiled.end()) {
+        if (it->second == in_progress)
+            return std::nullopt;
+        return it->second;
+    }
+
+    const auto& object = std::get<Json::JsonObject>(schema._data);
+    const auto member = [&object](std::string_view key) -> const Json::Value* {
+        auto it = object.find(key);
+        return it != object.end() ? &it->second : nullptr;
+    };
+
+    // Other keywords next to "$ref" are ignored
+    if (const auto* reference = member("$ref")) {
+        if (!reference->is<std::string>())
+            return std::nullopt;
+        compiler.compiled[pointer] = in_progress;
+        const auto target = compile_reference(compiler, std::get<std::string>(*reference));
+        if (!target)
+            return std::nullopt;
+        compiler.compiled[pointer] = *target;
+        return target;
+    }
+
+    const auto index = _nodes.size();
+    _nodes.emplace_back();
+    compiler.compiled[pointer] = index;
+
+    Node node;
+    bool valid = true;
+    const auto subschema = [&](const Json::Value& value, const std::string& at) {
+        const auto result = compile(compiler, value, at);
+        valid = valid && result;
+        return result.value_or(accept_all);
+    };
+    const auto subschemas = [&](const char* key, std::vector<std::size_t>& nodes) {
+        const auto* value = member(key);
+        if (!value)
+            return;
+        if (!value->is<Json>() || !std::holds_alternative<Json::JsonArray>(std::get<Json>(*value)._data)
+            || std::get<Json>(*value).elements().empty()) {
+            valid = false;
+            return;
+        }
+        const auto& elements = std::get<Json>(*value).elements();
+        for (std::size_t i = 0; i < elements.size(); ++i)
+            nodes.push_back(subschema(elements[i], JsonPatch::append_token(JsonPatch::append_token(pointer, key), std::to_string(i))));
+    };
+    const auto optional_subschema = [&](const char* key, std::optional<std::size_t>& target) {
+        if (const auto* value = member(key))
+            target = subschema(*value, JsonPatch::append_token(pointer, key));
+    };
+    const auto bound = [&](const char* key, auto& target) {
+        const auto* value = member(key);
+        if (!value)
+            return;
+        if constexpr (std::is_same_v<std::decay_t<decltype(target)>, std::optional<double>>)
+            target = number(*value);
+        else
+            target = count(*value);
+        valid = valid && target;
+    };
+    const auto members_of = [&](const char* key) -> const Json::JsonObject* {
+        const auto* value = member(key);
+        if (!value)
+            return nullptr;
+        if (!value->is<Json>() || !std::holds_alternative<Json::JsonObject>(std::get<Json>(*value)._data)) {
+            valid = false;
+            return nullptr;
+        }
+        return &std::get<Json::JsonObject>(std::get<Json>(*value)._data);
+    };
+    const auto strings = [&](const Json::Value& value, std::vector<std::string>& result) {
+        if (!value.is<Json>() || !std::holds_alternative<Json::JsonArray>(std::get<Json>(value)._data)) {
+            valid = false;
+            return;
+        }
+        for (const auto& element : std::get<Json>(value).elements()) {
+            if (!element.is<std::string>()) {
+                valid = false;
+                return;
+            }
+            result.push_back(std::get<std::string>(element));
+        }
+    };
+
+    if (const auto* type = member("type")) {
+        const auto type_bit = [](const Json::Value& name) -> std::uint8_t {
+            static const std::pair<const char*, std::uint8_t> names[] = {
+                    {"null", Null}, {"boolean", Boolean}, {"integer", Integer}, {"number", Number},
+                    {"string", String}, {"object", Object}, {"array", Array}};
+            for (const auto& [text, bit] : names) {
+                if (name.is<std::string>() && std::get<std::string>(name) == text)
+                    return bit;
+            }
+            return 0;
+        };
+        node.types = 0;
+        if (type->is<Json>() && std::holds_alternative<Json::JsonArray>(std::get<Json>(*type)._data)) {
+            for (const auto& name : std::get<Json>(*type).elements()) {
+                const auto bit = type_bit(name);
+                valid = valid && bit;
+                node.types |= bit;
+            }
+        } else {
+            node.types = type_bit(*type);
+            valid = valid && node.types;
+        }
+    }
+
+    if (const auto* values = member("enum")) {
+        if (values->is<Json>() && std::holds_alternative<Json::JsonArray>(std::get<Json>(*values)._data))
+            node.enum_values = std::get<Json>(*values).elements();
+        else
+            valid = false;
+    }
+    if (const auto* value = member("const")) {
+        // With "enum" next to it, the value must be one of the enum and equal the const
+        if (node.enum_values) {
+            node.all_of.push_back(_nodes.size());
+            auto& constant = _nodes.emplace_back();
+            constant.enum_values.emplace(1, *value);
+            constant.streamable = false;
+        } else {
+            node.enum_values.emplace(1, *value);
+        }
+    }
+
+    bound("minimum", node.minimum);
+    bound("maximum", node.maximum);
+    bound("exclusiveMinimum", node.exclusive_minimum);
+    bound("exclusiveMaximum", node.exclusive_maximum);
+    bound("multipleOf", node.multiple_of);
+    valid = valid && (!node.multiple_of || *node.multiple_of > 0);
+
+    bound("minLength", node.min_length);
+    bound("maxLength", node.max_length);
+    if (const auto* pattern = member("pattern")) {
+        node.pattern = regex(*pattern);
+        valid = valid && node.pattern;
+    }
+
+    if (const auto* items = member("items")) {
+        if (items->is<Json>() && std::holds_alternative<Json::JsonArray>(std::get<Json>(*items)._data)) {
+            const auto& elements = std::get<Json>(*items).elements();
+            for (std::size_t i = 0; i < elements.size(); ++i)
+                node.tuple_items.push_back(subschema(elements[i], JsonPatch::append_token(JsonPatch::append_token(pointer, "items"), std::to_string(i))));
+            optional_subschema("additionalItems", node.additional_items);
+        } else {
+            node.items = subschema(*items, JsonPatch::append_token(pointer, "items"));
+        }
+    }
+    optional_subschema("contains", node.contains);
+    bound("minItems", node.min_items);
+    bound("maxItems", node.max_items);
+    if (const auto* unique = member("uniqueItems")) {
+        valid = valid && unique->is<bool>();
+        node.unique_items = unique->is<bool>() && std::get<bool>(*unique);
+    }
+
+    const auto property = [&node](const std::string& name) -> Property& {
+        auto it = std::lower_bound(node.properties.begin(), node.properties.end(), name,
+                                   [](const Property& property, const std::string& name) { return property.name < name; });
+        if (it == node.properties.end() || it->name != name)
+            it = node.properties.insert(it, Property{name, std::nullopt, std::nullopt});
+        return *it;
+    };
+    if (const auto* properties = members_of("properties")) {
+        for (const auto& [name, value] : *properties)
+            property(name).schema = subschema(value, JsonPatch::append_token(JsonPatch::append_token(pointer, "properties"), name));
+    }
+    if (const auto* required = member("required")) {
+        std::vector<std::string> names;
+        strings(*required, names);
+        for (const auto& name : names) {
+            auto& entry = property(name);
+            if (!entry.required)
+                entry.required = node.required_count++;
+        }
+    }
+    if (const auto* patterns = members_of("patternProperties")) {
+        for (const auto& [name, value] : *patterns) {
+            auto expression = regex(Json::Value(name));
+            if (!expression) {
+                valid = false;
+                continue;
+            }
+            node.pattern_properties.emplace_back(std::move(*expression),
+                                                 subschema(value, JsonPatch::append_token(JsonPatch::append_token(pointer, "patternProperties"), name)));
+        }
+    }
+    optional_subschema("additionalProperties", node.additional_properties);
+    optional_subschema("propertyNames", node.property_names);
+    bound("minProperties", node.min_properties);
+    bound("maxProperties", node.max_properties);
+    if (const auto* dependencies = members_of("dependencies")) {
+        for (const auto& [name, value] : *dependencies) {
+            if (value.is<Json>() && std::holds_alternative<Json::JsonArray>(std::get<Json>(value)._data))
+                strings(value, node.dependent_required.emplace_back(name, std::vector<std::string>()).second);
+            else
+                node.dependent_schemas.emplace_back(name, subschema(value, JsonPatch::append_token(JsonPatch::append_token(pointer, "dependencies"), name)));
+        }
+    }
+
+    subschemas("allOf", node.all_of);
+    subschemas("anyOf", node.any_of);
+    subschemas("oneOf", node.one_of);
+    optional_subschema("not", node.not_schema);
+    optional_subschema("if", node.if_schema);
+    optional_subschema("then", node.then_schema);
+    optional_subschema("else", node.else_schema);
+
+    node.streamable = !node.enum_values && !node.unique_items && !node.contains && node.pattern_properties.empty()
+                      && !node.property_names && node.dependent_required.empty() && node.dependent_schemas.empty()
+                      && node.all_of.empty() && node.any_of.empty() && node.one_of.empty() && !node.not_schema
+                      && !node.if_schema && node.required_count <= 64;
+
+    if (!valid)
+        return std::nullopt;
+    _nodes[index] = std::move(node);
+    return index;
+}
+
+bool JsonSchema::equal(const Json::Value& first, const Json::Value& second) {
+    return JsonPatch::equal(first, second);
+}
+
+bool JsonSchema::equal(const Json::Value& first, const Json& second) {
+    return first.is<Json>() && JsonPatch::equal(std::get<Json>(first), second);
+}
+
+template<class Value>
+bool JsonSchema::validate_common(const Node& node, const Value& value, Error* error) const {
+    const auto validate_node = [this, &value](std::size_t index, Error* error) {
+        if constexpr (std::is_same_v<Value, Json>)
+            return validate_json(index, value, error);
+        else
+            return validate_value(index, value, error);
+    };
+
+    if (node.enum_values && std::none_of(node.enum_values->begin(), node.enum_values->end(),
+                                         [&value](const Json::Value& allowed) { return equal(allowed, value); }))
+        return fail(error, node.enum_values->size() == 1 ? "value is not the const" : "value is not in the enum");
+
+    for (const auto index : node.all_of) {
+        if (!validate_node(index, error))
+            return false;
+    }
+    if (!node.any_of.empty()
+        && std::none_of(node.any_of.begin(), node.any_of.end(), [&](std::size_t index) { return validate_node(index, nullptr); }))
+        return fail(error, "value matches no schema of anyOf");
+    if (!node.one_of.empty()
+        && std::count_if(node.one_of.begin(), node.one_of.end(), [&](std::size_t index) { return validate_node(index, nullptr); }) != 1)
+        return fail(error, "value does not match exactly one schema of oneOf");
+    if (node.not_schema && validate_node(*node.not_schema, nullptr))
+        return fail(error, "value matches the schema of not");
+    if (node.if_schema) {
+        const auto& branch = validate_node(*node.if_schema, nullptr) ? node.then_schema : node.else_schema;
+        if (branch && !validate_node(*branch, error))
+            return false;
+    }
+    return true;
+}
+
+bool JsonSchema::validate_number(const Node& node, double value, bool integer, Error* error) const {
+    if (!(node.types & (integer ? Integer | Number : Number)))
+        return fail(error, "unexpected type");
+    if (node.minimum && value < *node.minimum)
+        return fail(error, "value is less than the minimum");
+    if (node.maximum && value > *node.maximum)
+        return fail(error, "value is greater than the maximum");
+    if (node.exclusive_minimum && value <= *node.exclusive_minimum)
+        return fail(error, "value is not greater than the exclusive minimum");
+    if (node.exclusive_maximum && value >= *node.exclusive_maximum)
+        return fail(error, "value is not less than the exclusive maximum");
+    if (node.multiple_of) {
+        const auto quotient = value / *node.multiple_of;
+        if (!std::isfinite(quotient) || std::fabs(quotient - std::round(quotient)) > 1e-9 * std::max(1.0, std::fabs(quotient)))
+            return fail(error, "value is not a multiple of multipleOf");
+    }
+    return true;
+}
+
+bool JsonSchema::validate_string(const Node& node, std::string_view value, Error* error) const {
+    if (!(node.types & String))
+        return fail(error, "unexpected type");
+    if (node.min_length || node.max_length) {
+        const auto length = code_points(value);
+        if (node.min_length && length < *node.min_length)
+            return fail(error, "string is shorter than minLength");
+        if (node.max_length && length > *node.max_length)
+            return fail(error, "string is longer than maxLength");
+    }
+    if (node.pattern && !node.pattern->search(value))
+        return fail(error, "string does not match the pattern");
+    return true;
+}
+
+bool JsonSchema::validate_value(std::size_t index, const Json::Value& value, Error* error) const {
+    if (value.is<Json>())
+        return validate_json(index, std::get<Json>(value), error);
+
+    const auto& node = _nodes[index];
+    if (value.is<Json::Null>()) {
+        if (!(node.types & Null))
+            return fail(error, "unexpected type");
+    } else if (value.is<bool>()) {
+        if (!(node.types & Boolean))
+            return fail(error, "unexpected type");
+    } else if (value.is<std::string>()) {
+        if (!validate_string(node, std::get<std::string>(value), error))
+            return false;
+    } else {
+        const auto result = *number(value);
+        if (!validate_number(node, result, !value.is<double>() || result == std::floor(result), error))
+            return false;
+    }
+    return validate_common(node, value, error);
+}
+
+bool JsonSchema::validate_json(std::size_t index, const Json& json, Error* error) const {
+    const auto& node = _nodes[index];
+    const bool valid = visit_variant(json._data, [&](const Json::JsonObject& object) {
+        if (!(node.types & Object))
+            return fail(error, "unexpected type");
+        if (node.min_properties && object.size() < *node.min_properties)
+            return fail(error, "object has less members than minProperties");
+        if (node.max_properties && object.size() > *node.max_properties)
+            return fail(error, "object has more members than maxProperties");
+
+        for (const auto& property : node.properties) {
+            if (property.required && object.find(property.name) == object.end())
+                return fail(error, "required member " + property.name + " is missing");
+        }
+        for (const auto& [name, members] : node.dependent_required) {
+            if (object.find(name) == object.end())
+                continue;
+            for (const auto& dependency : members) {
+                if (object.find(dependency) == object.end())
+                    return fail(error, "member " + dependency + " required by " + name + " is missing");
+            }
+        }
+        for (const auto& [name, schema] : node.dependent_schemas) {
+            if (object.find(name) != object.end() && !validate_json(schema, json, error))
+                return false;
+        }
+
+        for (const auto& [key, value] : object) {
+            if (node.property_names && !validate_value(*node.property_names, Json::Value(key), error))
+                return fail_at(error, key);
+
+            bool matched = false;
+            auto it = std::lower_bound(node.properties.begin(), node.properties.end(), key,
+                                       [](const Property& property, const std::string& key) { return property.name < key; });
+            if (it != node.properties.end() && it->name == key && it->schema) {
+                matched = true;
+                if (!validate_value(*it->schema, value, error))
+                    return fail_at(error, key);
+            }
+            for (const auto& [pattern, schema] : node.pattern_properties) {
+                if (!pattern.search(key))
+                    continue;
+                matched = true;
+                if (!validate_value(schema, value, error))
+                    return fail_at(error, key);
+            }
+            if (!matched && node.additional_properties && !validate_value(*node.additional_properties, value, error))
+                return fail_at(error, key);
+        }
+        return true;
+    }, [&](const Json::JsonArray& array) {
+        if (!(node.types & Array))
+            return fail(error, "unexpected type");
+        if (node.min_items && array.size() < *node.min_items)
+            return fail(error, "array has less elements than minItems");
+        if (node.max_items && array.size() > *node.max_items)
+            return fail(error, "array has more elements than maxItems");
+
+        for (std::size_t i = 0; i < array.size(); ++i) {
+            const auto schema = i < node.tuple_items.size() ? std::optional(node.tuple_items[i])
+                                                            : node.items ? node.items : node.additional_items;
+            if (schema && !validate_value(*schema, array[i], error))
+                return fail_at(error, i);
+        }
+        if (node.unique_items) {
+            for (std::size_t i = 1; i < array.size(); ++i) {
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (equal(array[j], array[i]))
+                        return fail(error, "array elements are not unique");
+                }
+            }
+        }
+        if (node.contains && std::none_of(array.begin(), array.end(), [&](const Json::Value& element) {
+            return validate_value(*node.contains, element, nullptr);
+        }))
+            return fail(error, "array contains no element matching contains");
+        return true;
+    });
+    return valid && validate_common(node, json, error);
+}
+
+bool JsonSchema::validate(const Json& document, Error* error) const {
+    if (!_valid)
+        return fail(error, "the schema is not valid");
+    if (!document.valid())
+        return fail(error, "the document is not valid");
+    return validate_json(_root, document, error);
+}
+
+bool JsonSchema::validate_text(std::size_t index, JsonCursor& cursor, std::size_t depth, Error* error) const {
+    const auto& node = _nodes[index];
+    const auto invalid_text = [&cursor, error]() {
+        return fail(error, "invalid JSON at offset " + std::to_string(cursor.position()));
+    };
+
+    if (!node.streamable) {
+        // Find the end of the value, then build it for the checks that need it whole
+        cursor.skip_whitespace();
+        const auto begin = cursor.position();
+        std::optional<Json::Value> value(std::in_place);
+        if (!validate_text(accept_all, cursor, depth, nullptr)
+            || !Json::parse_values(cursor.input().substr(begin, cursor.position() - begin), &*value, 1, depth))
+            return invalid_text();
+        return validate_value(index, *value, error);
+    }
+
+    switch (cursor.peek()) {
+        case '{': {
+            if (!(node.types & Object))
+                return fail(error, "unexpected type");
+            if (depth + 1 > Json::max_depth || !cursor.consume('{'))
+                return invalid_text();
+
+            std::size_t members = 0;
+            std::uint64_t required = 0;
+            std::string unescaped;
+            if (!cursor.consume('}')) {
+                do {
+                    if (cursor.peek() != '"')
+                        return invalid_text();
+                    const auto raw_key = cursor.read_raw_string();
+                    if (!raw_key || !cursor.consume(':'))
+                        return invalid_text();
+
+                    auto schema = node.additional_properties.value_or(accept_all);
+                    auto key = *raw_key;
+                    if (!node.properties.empty()) {
+                        if (key.find('\\') != std::string_view::npos) {
+                            unescaped = JsonCursor::unescape(key);
+                            key = unescaped;
+                        }
+                        auto it = std::lower_bound(node.properties.begin(), node.properties.end(), key,
+                                                   [](const Property& property, std::string_view key) { return property.name < key; });
+                        if (it != node.properties.end() && it->name == key) {
+                            if (it->required)
+                                required |= std::uint64_t(1) << *it->required;
+                            if (it->schema)
+                                schema = *it->schema;
+                        }
+                    }
+
+                    if (!validate_text(schema, cursor, depth + 1, error))
+                        return fail_at(error, key.find('\\') == std::string_view::npos ? std::string(key) : JsonCursor::unescape(key));
+                    ++members;
+                } while (cursor.consume(','));
+                if (!cursor.consume('}'))
+                    return invalid_text();
+            }
+
+            if (node.min_properties && members < *node.min_properties)
+                return fail(error, "object has less members than minProperties");
+            if (node.max_properties && members > *node.max_properties)
+                return fail(error, "object has more members than maxProperties");
+            for (const auto& property : node.properties) {
+                if (property.required && !(required & (std::uint64_t(1) << *property.required)))
+                    return fail(error, "required member " + property.name + " is missing");
+            }
+            return true;
+        }
+        case '[': {
+            if (!(node.types & Array))
+                return fail(error, "unexpected type");
+            if (depth + 1 > Json::max_depth || !cursor.consume('['))
+                return invalid_text();
+
+            std::size_t elements = 0;
+            if (!cursor.consume(']')) {
+                do {
+                    const auto schema = elements < node.tuple_items.size() ? node.tuple_items[elements]
+                                                                           : node.items.value_or(node.additional_items.value_or(accept_all));
+                    if (!validate_text(schema, cursor, depth + 1, error))
+                        return fail_at(error, elements);
+                    ++elements;
+                } while (cursor.consume(','));
+                if (!cursor.consume(']'))
+                    return invalid_text();
+            }
+
+            if (node.min_items && elements < *node.min_items)
+                return fail(error, "array has less elements than minItems");
+            if (node.max_items && elements > *node.max_items)
+                return fail(error, "array has more elements than maxItems");
+            return true;
+        }
+        case '"': {
+            const auto raw = cursor.read_raw_string();
+            if (!raw)
+                return invalid_text();
+            if (raw->find('\\') == std::string_view::npos)
+                return validate_string(node, *raw, error);
+            return validate_string(node, JsonCursor::unescape(*raw), error);
+        }
+        case 'n':
+            if (!cursor.consume_literal("null"))
+                return invalid_text();
+            return (node.types & Null) || fail(error, "unexpected type");
+        case 't':
+        case 'f':
+            if (!cursor.consume_literal(cursor.peek() == 't' ? "true" : "false"))
+                return invalid_text();
+            return (node.types & Boolean) || fail(error, "unexpected type");
+        default: {
+            const auto text = cursor.read_number();
+            if (!text)
+                return invalid_text();
+            double value = 0;
+            if (!JsonCursor::to_double(*text, value))
+                return invalid_text();
+            const bool integer = text->find_first_of(".eE") == std::string_view::npos || value == std::floor(value);
+            return validate_number(node, value, integer, error);
+        }
+    }
+}
+
+bool JsonSchema::validate_text(std::string_view text, Error* error) const {
+    if (!_valid)
+        return fail(error, "the schema is not valid");
+
+    // Documents are objects or arrays, as for Json::parse
+    JsonCursor cursor(text);
+    const auto first = cursor.peek();
+    if (first != '{' && first != '[')
+        return fail(error, "invalid JSON at offset " + std::to_string(cursor.position()));
+    if (!validate_text(_root, cursor, 0, error))
+        return false;
+
+    cursor.skip_whitespace();
+    return cursor.at_end() || fail(error, "invalid JSON at offset " + std::to_string(cursor.position()));
+}
+
+}
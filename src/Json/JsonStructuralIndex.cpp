@@ -0,0 +1,352 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonStructuralIndex.hpp>
+#include <Json/JsonCursor.hpp>
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+// The vector classifiers need the target attribute and runtime detection of GCC and Clang
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CORE_JSON_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Core {
+
+namespace {
+
+constexpr std::size_t block_size = 64;
+
+/// \brief Character classes of a block, one bit per character.
+struct BlockMasks {
+    std::uint64_t quote = 0;
+    std::uint64_t backslash = 0;
+    std::uint64_t structural = 0;
+    std::uint64_t whitespace = 0;
+    std::uint64_t control = 0;
+};
+
+using Classifier = BlockMasks (*)(const char *block);
+
+/// \brief Index of the lowest set bit of \param bits, which must not be 0.
+int lowest_bit(std::uint64_t bits) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(bits);
+#else
+    int index = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+BlockMasks classify_scalar(const char *block) {
+    BlockMasks masks;
+    for (std::size_t i = 0; i < block_size; ++i) {
+        const auto bit = std::uint64_t(1) << i;
+        const auto character = static_cast<unsigned char>(block[i]);
+        switch (character) {
+            case '"':
+                masks.quote |= bit;
+                break;
+            case '\\':
+                masks.backslash |= bit;
+                break;
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                masks.structural |= bit;
+                break;
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                masks.whitespace |= bit;
+                break;
+            default:
+                break;
+        }
+        if (character < 0x20)
+            masks.control |= bit;
+    }
+    return masks;
+}
+
+#if defined(CORE_JSON_X86)
+// Lambdas do not inherit the target attribute, the comparisons are helpers instead.
+
+__attribute__((target("sse4.2")))
+inline __m128i equals_sse42(__m128i chunk, char character) {
+    return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(character));
+}
+
+__attribute__((target("sse4.2")))
+inline std::uint64_t mask_sse42(__m128i matches, std::size_t offset) {
+    return static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(matches))) << offset;
+}
+
+__attribute__((target("sse4.2")))
+BlockMasks classify_sse42(const char *block) {
+    BlockMasks masks;
+    for (std::size_t offset = 0; offset < block_size; offset += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + offset));
+
+        masks.quote |= mask_sse42(equals_sse42(chunk, '"'), offset);
+        masks.backslash |= mask_sse42(equals_sse42(chunk, '\\'), offset);
+        masks.structural |= mask_sse42(_mm_or_si128(
+            _mm_or_si128(_mm_or_si128(equals_sse42(chunk, '{'), equals_sse42(chunk, '}')),
+                         _mm_or_si128(equals_sse42(chunk, '['), equals_sse42(chunk, ']'))),
+            _mm_or_si128(equals_sse42(chunk, ':'), equals_sse42(chunk, ','))), offset);
+        masks.whitespace |= mask_sse42(
+            _mm_or_si128(_mm_or_si128(equals_sse42(chunk, ' '), equals_sse42(chunk, '\t')),
+                         _mm_or_si128(equals_sse42(chunk, '\n'), equals_sse42(chunk, '\r'))), offset);
+        // unsigned character <= 0x1f
+        masks.control |= mask_sse42(
+            _mm_cmpeq_epi8(_mm_max_epu8(chunk, _mm_set1_epi8(0x1f)), _mm_set1_epi8(0x1f)), offset);
+    }
+    return masks;
+}
+
+__attribute__((target("avx2")))
+inline __m256i equals_avx2(__m256i chunk, char character) {
+    return _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(character));
+}
+
+__attribute__((target("avx2")))
+inline std::uint64_t mask_avx2(__m256i matches, std::size_t offset) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(matches))) << offset;
+}
+
+__attribute__((target("avx2")))
+BlockMasks classify_avx2(const char *block) {
+    BlockMasks masks;
+    for (std::size_t offset = 0; offset < block_size; offset += 32) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + offset));
+
+        masks.quote |= mask_avx2(equals_avx2(chunk, '"'), offset);
+        masks.backslash |= mask_avx2(equals_avx2(chunk, '\\'), offset);
+        masks.structural |= mask_avx2(_mm256_or_si256(
+            _mm256_or_si256(_mm256_or_si256(equals_avx2(chunk, '{'), equals_avx2(chunk, '}')),
+                            _mm256_or_si256(equals_avx2(chunk, '['), equals_avx2(chunk, ']'))),
+            _mm256_or_si256(equals_avx2(chunk, ':'), equals_avx2(chunk, ','))), offset);
+        masks.whitespace |= mask_avx2(
+            _mm256_or_si256(_mm256_or_si256(equals_avx2(chunk, ' '), equals_avx2(chunk, '\t')),
+                            _mm256_or_si256(equals_avx2(chunk, '\n'), equals_avx2(chunk, '\r'))), offset);
+        masks.control |= mask_avx2(
+            _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, _mm256_set1_epi8(0x1f)), _mm256_set1_epi8(0x1f)), offset);
+    }
+    return masks;
+}
+#endif
+
+bool supports(JsonStructuralIndex::Implementation implementation) {
+    switch (implementation) {
+        case JsonStructuralIndex::Implementation::Scalar:
+            return true;
+#if defined(CORE_JSON_X86)
+        case JsonStructuralIndex::Implementation::SSE42:
+            return __builtin_cpu_supports("sse4.2");
+        case JsonStructuralIndex::Implementation::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+Classifier classifier_of(JsonStructuralIndex::Implementation implementation) {
+    switch (implementation) {
+#if defined(CORE_JSON_X86)
+        case JsonStructuralIndex::Implementation::SSE42:
+            return classify_sse42;
+        case JsonStructuralIndex::Implementation::AVX2:
+            return classify_avx2;
+#endif
+        default:
+            return classify_scalar;
+    }
+}
+
+/// \brief Mask of the characters escaped by a backslash.
+/// \param escape_carry set if the first character of the block is escaped by the
+/// previous block, updated for the next block.
+std::uint64_t escaped_characters(std::uint64_t backslash, bool &escape_carry) {
+    std::uint64_t escaped = 0;
+    if (escape_carry) {
+        escaped |= 1;
+        backslash &= ~std::uint64_t(1);
+    }
+    escape_carry = false;
+
+    // backslashes are rare, walk them one by one
+    while (backslash) {
+        const auto position = lowest_bit(backslash);
+        if (position == 63) {
+            escape_carry = true;
+        } else {
+            const auto next = std::uint64_t(1) << (position + 1);
+            escaped |= next;
+            backslash &= ~next;
+        }
+        backslash &= backslash - 1;
+    }
+    return escaped;
+}
+
+/// \brief Every bit is the xor of itself and the bits below it.
+std::uint64_t prefix_xor(std::uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+void append_positions(std::vector<std::uint32_t> &positions, std::uint64_t bits, std::size_t offset) {
+    while (bits) {
+        positions.push_back(static_cast<std::uint32_t>(offset + lowest_bit(bits)));
+        bits &= bits - 1;
+    }
+}
+
+}
+
+JsonStructuralIndex::JsonStructuralIndex(std::string_view input)
+    : JsonStructuralIndex(input, best_implementation()) {}
+
+JsonStructuralIndex::JsonStructuralIndex(std::string_view input, Implementation implementation)
+    : _input(input), _implementation(supports(implementation) ? implementation : Implementation::Scalar) {
+    if (_input.size() >= std::numeric_limits<std::uint32_t>::max())
+        return;
+
+    const auto classify = classifier_of(_implementation);
+    const auto block_count = (_input.size() + block_size - 1) / block_size;
+    _string_escapes.resize(block_count);
+
+    bool escape_carry = false;
+    std::uint64_t in_string_carry = 0;
+    std::uint64_t scalar_carry = 0;
+    for (std::size_t block = 0; block < block_count; ++block) {
+        const auto offset = block * block_size;
+
+        BlockMasks masks;
+        if (offset + block_size <= _input.size()) {
+            masks = classify(_input.data() + offset);
+        } else {
+            // the last, partial block is padded with whitespace
+            std::array<char, block_size> padded;
+            padded.fill(' ');
+            std::memcpy(padded.data(), _input.data() + offset, _input.size() - offset);
+            masks = classify(padded.data());
+        }
+
+        const auto quotes = masks.quote & ~escaped_characters(masks.backslash, escape_carry);
+        // set from the opening quote (inclusive) to the closing quote (exclusive)
+        const auto in_string = prefix_xor(quotes) ^ in_string_carry;
+        in_string_carry = static_cast<std::uint64_t>(static_cast<std::int64_t>(in_string) >> 63);
+
+        const auto scalar = ~(masks.structural | masks.whitespace | masks.quote) & ~in_string;
+        const auto scalar_starts = scalar & ~((scalar << 1) | scalar_carry);
+        scalar_carry = scalar >> 63;
+
+        append_positions(_structurals, (masks.structural & ~in_string) | (quotes & in_string) | scalar_starts,
+                         offset);
+        append_positions(_string_ends, quotes & ~in_string, offset);
+        _string_escapes[block] = (masks.backslash | masks.control) & in_string;
+    }
+
+    _valid = in_string_carry == 0;
+}
+
+JsonStructuralIndex::Implementation JsonStructuralIndex::best_implementation() {
+    static const auto best = []() {
+        for (auto implementation : {Implementation::AVX2, Implementation::SSE42}) {
+            if (supports(implementation))
+                return implementation;
+        }
+        return Implementation::Scalar;
+    }();
+    return best;
+}
+
+bool JsonStructuralIndex::has_escape(std::size_t begin, std::size_t end) const {
+    if (begin >= end)
+        return false;
+
+    const auto first_word = begin / block_size;
+    const auto last_word = (end - 1) / block_size;
+    for (auto word = first_word; word <= last_word; ++word) {
+        auto bits = _string_escapes[word];
+        if (word == first_word)
+            bits &= ~std::uint64_t(0) << (begin % block_size);
+        if (word == last_word && end % block_size != 0)
+            bits &= ~(~std::uint64_t(0) << (end % block_size));
+        if (bits)
+            return true;
+    }
+    return false;
+}
+
+std::string_view JsonStructuralIndex::Cursor::scalar() const {
+    const auto& structurals = _index._structurals;
+    const std::size_t begin = structurals[_next];
+    auto end = _next + 1 < structurals.size() ? std::size_t(structurals[_next + 1]) : _index._input.size();
+    while (end > begin && JsonCursor::is_whitespace(_index._input[end - 1]))
+        --end;
+    return _index._input.substr(begin, end - begin);
+}
+
+bool JsonStructuralIndex::Cursor::consume_literal(std::string_view literal) {
+    if (at_end() || scalar() != literal)
+        return false;
+    ++_next;
+    return true;
+}
+
+std::optional<std::string_view> JsonStructuralIndex::Cursor::read_number() {
+    if (at_end())
+        return std::nullopt;
+
+    // The number must span the whole scalar, "01" or "1x" are not numbers
+    const auto text = scalar();
+    JsonCursor cursor(text);
+    const auto number = cursor.read_number();
+    if (!number || !cursor.at_end())
+        return std::nullopt;
+    ++_next;
+    return number;
+}
+
+std::optional<std::string> JsonStructuralIndex::Cursor::read_string() {
+    if (peek() != '"' || _next_string >= _index._string_ends.size())
+        return std::nullopt;
+
+    const std::size_t begin = _index._structurals[_next];
+    const std::size_t end = _index._string_ends[_next_string];
+    std::optional<std::string> result;
+    if (!_index.has_escape(begin + 1, end)) {
+        result.emplace(_index._input.substr(begin + 1, end - begin - 1));
+    } else {
+        // Escapes are decoded and control characters rejected by the scalar cursor
+        JsonCursor cursor(_index._input.substr(begin, end + 1 - begin));
+        result = cursor.read_string();
+        if (!result || !cursor.at_end())
+            return std::nullopt;
+    }
+    ++_next;
+    ++_next_string;
+    return result;
+}
+
+}
@@ -0,0 +1,164 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/JsonWriter.hpp>
+#include <Json/JsonCursor.hpp>
+
+#include <array>
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+
+#include <Utils/Utils.hpp>
+
+namespace Core {
+
+namespace {
+
+/// \brief Check if \param c has to be escaped in a JSON string.
+bool needs_escape(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+}
+
+void JsonWriter::new_line(unsigned depth) {
+    if (_style != Style::Pretty)
+        return;
+
+    // The indentation of the deepest level so far is kept, shallower levels use its prefix
+    const auto width = depth * _indent.size();
+    while (_indentation.size() < width)
+        _indentation += _indent;
+
+    _buffer += '\n';
+    _buffer.append(_indentation, 0, width);
+}
+
+JsonWriter& JsonWriter::write(const Json& json) {
+    write_json(json, 0);
+    return *this;
+}
+
+void JsonWriter::write_json(const Json& json, unsigned depth) {
+    const auto* separator = _style == Style::Pretty ? ": " : ":";
+
+    visit_variant(json._data, [this, depth](const Json::JsonArray& array) {
+        _buffer += '[';
+        for (auto it = array.begin(); it != array.end(); ++it) {
+            if (it != array.begin())
+                _buffer += ',';
+            new_line(depth + 1);
+            write_value(*it, depth + 1);
+        }
+        if (!array.empty())
+            new_line(depth);
+        _buffer += ']';
+    }, [this, depth, separator](const Json::JsonObject& object) {
+        _buffer += '{';
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            if (it != object.begin())
+                _buffer += ',';
+            new_line(depth + 1);
+            write_string(it->first);
+            _buffer += separator;
+            write_value(it->second, depth + 1);
+        }
+        if (!object.empty())
+            new_line(depth);
+        _buffer += '}';
+    });
+}
+
+void JsonWriter::write_value(const Json::Value& value, unsigned depth) {
+    visit_variant(value.to_std_variant(), [this, depth](const Json& json) {
+        write_json(json, depth);
+    }, [this](const std::string& string) {
+        write_string(string);
+    }, [this](const Json::Null&) {
+        _buffer += "null";
+    }, [this](const bool& boolean) {
+        _buffer += boolean ? "true" : "false";
+    }, [this](const double& number) {
+        write_number(number);
+    }, [this](const auto& number) {
+        write_number(static_cast<long long>(number));
+    });
+}
+
+JsonWriter& JsonWriter::write_string(std::string_view value) {
+    static constexpr char hex[] = "0123456789abcdef";
+
+    _buffer += '"';
+    std::size_t run = 0;
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        const auto c = static_cast<unsigned char>(value[i]);
+        if (!needs_escape(c))
+            continue;
+
+        // Characters that need no escaping are appended in runs
+        _buffer.append(value.data() + run, i - run);
+        run = i + 1;
+
+        _buffer += '\\';
+        switch (c) {
+            case '"':  _buffer += '"'; break;
+            case '\\': _buffer += '\\'; break;
+            case '\b': _buffer += 'b'; break;
+            case '\f': _buffer += 'f'; break;
+            case '\n': _buffer += 'n'; break;
+            case '\r': _buffer += 'r'; break;
+            case '\t': _buffer += 't'; break;
+            default:
+                _buffer += "u00";
+                _buffer += hex[c >> 4];
+                _buffer += hex[c & 0xf];
+                break;
+        }
+    }
+    _buffer.append(value.data() + run, value.size() - run);
+    _buffer += '"';
+    return *this;
+}
+
+JsonWriter& JsonWriter::write_number(long long value) {
+    std::array<char, 24> digits{};
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    _buffer.append(digits.data(), result.ptr);
+    return *this;
+}
+
+JsonWriter& JsonWriter::write_number(double value) {
+    if (!std::isfinite(value)) {
+        _buffer += "null";
+        return *this;
+    }
+
+    std::array<char, 32> digits{};
+#if defined(__cpp_lib_to_chars)
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    const std::string_view text(digits.data(), static_cast<std::size_t>(result.ptr - digits.data()));
+#else
+    // Without floating point std::to_chars (before GCC 11), the shortest precision
+    // that reads back to the same value, the decimal point is the locale's
+    std::string_view text;
+    for (int precision = 15; precision <= 17; ++precision) {
+        const auto length = std::snprintf(digits.data(), digits.size(), "%.*g", precision, value);
+        text = std::string_view(digits.data(), static_cast<std::size_t>(length));
+        if (const auto point = text.find(*std::localeconv()->decimal_point); point != std::string_view::npos)
+            digits[point] = '.';
+
+        double read_back = 0;
+        if (JsonCursor::to_double(text, read_back) && read_back == value)
+            break;
+    }
+#endif
+    _buffer += text;
+    if (text.find_first_of(".e") == std::string_view::npos)
+        _buffer += ".0";
+    return *this;
+}
+
+}
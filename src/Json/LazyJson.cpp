@@ -0,0 +1,308 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/LazyJson.hpp>
+#include <Json/JsonCursor.hpp>
+#include <FileManager/MappedFile.hpp>
+
+#include <functional>
+#include <limits>
+
+namespace Core {
+
+bool LazyJson::index_value(JsonCursor& cursor, std::size_t depth) {
+    const auto kind = cursor.peek();
+    if (kind == '{' || kind == '[')
+        return index_container(cursor, depth + 1);
+
+    const auto begin = cursor.position();
+    std::optional<std::string_view> text;
+    switch (kind) {
+        case '"':
+            text = cursor.read_raw_string();
+            break;
+        case 'n':
+            text = cursor.consume_literal("null") ? std::optional(std::string_view("null")) : std::nullopt;
+            break;
+        case 't':
+            text = cursor.consume_literal("true") ? std::optional(std::string_view("true")) : std::nullopt;
+            break;
+        case 'f':
+            text = cursor.consume_literal("false") ? std::optional(std::string_view("false")) : std::nullopt;
+            break;
+        default:
+            text = cursor.read_number();
+            break;
+    }
+
+    if (!text)
+        return false;
+    _nodes.push_back({static_cast<std::uint32_t>(begin), static_cast<std::uint32_t>(text->size())});
+    return true;
+}
+
+bool LazyJson::index_container(JsonCursor& cursor, std::size_t depth) {
+    const auto opening = cursor.peek();
+    const auto closing = opening == '{' ? '}' : ']';
+    if (depth > Json::max_depth)
+        return false;
+
+    const auto node = _nodes.size();
+    _nodes.push_back({static_cast<std::uint32_t>(cursor.position()), 0});
+    cursor.consume(opening);
+
+    if (!cursor.consume(closing)) {
+        do {
+            if (opening == '{') {
+                if (cursor.peek() != '"')
+                    return false;
+
+                const auto key_begin = cursor.position();
+                auto key = cursor.read_raw_string();
+                if (!key || !cursor.consume(':'))
+                    return false;
+                _nodes.push_back({static_cast<std::uint32_t>(key_begin), static_cast<std::uint32_t>(key->size())});
+            }
+
+            if (!index_value(cursor, depth))
+                return false;
+        } while (cursor.consume(','));
+
+        if (!cursor.consume(closing))
+            return false;
+    }
+
+    _nodes[node].extent = static_cast<std::uint32_t>(_nodes.size());
+    return true;
+}
+
+LazyJson::LazyJson(std::shared_ptr<const void> storage, std::string_view text)
+    : _storage(std::move(storage)), _text(text) {
+    if (_text.size() >= std::numeric_limits<std::uint32_t>::max())
+        return;
+
+    JsonCursor cursor(_text);
+    const auto first = cursor.peek();
+    _valid = (first == '{' || first == '[') && index_container(cursor, 1);
+
+    cursor.skip_whitespace();
+    if (!_valid || !cursor.at_end()) {
+        _valid = false;
+        _nodes.clear();
+    }
+    _nodes.shrink_to_fit();
+}
+
+LazyJson::LazyJson(std::string text) {
+    auto storage = std::make_shared<const std::string>(std::move(text));
+    const std::string_view view = *storage;
+    *this = LazyJson(std::move(storage), view);
+}
+
+LazyJson LazyJson::load(const std::string& path) {
+    auto file = std::make_shared<const MappedFile>(path);
+    const auto text = file->view();
+    return LazyJson(std::move(file), text);
+}
+
+LazyJson::Element LazyJson::root() const {
+    if (!_valid)
+        throw bad_json_access("Invalid JSON");
+    return Element(this, 0);
+}
+
+std::optional<Json::Value> LazyJson::get(const std::string& path) const {
+    return get(JsonPath(path));
+}
+
+std::optional<Json::Value> LazyJson::get(const JsonPath& path) const {
+    if (!_valid || path.empty())
+        return std::nullopt;
+
+    auto element = std::optional(root());
+    for (const auto& segment : path) {
+        if (segment.is_index())
+            element = element->find(segment.index());
+        else if (segment.escaped())
+            element = element->find(std::string_view(segment.key()));
+        else
+            element = element->find(segment.raw_key());
+
+        if (!element)
+            return std::nullopt;
+    }
+    return element->value();
+}
+
+std::size_t LazyJson::Element::next() const {
+    const auto& node = _document->_nodes[_node];
+    return is_object() || is_array() ? node.extent : _node + 1;
+}
+
+std::size_t LazyJson::Element::size() const {
+    if (!is_object() && !is_array())
+        return 0;
+
+    std::size_t count = 0;
+    const auto end = next();
+    for (auto child = _node + 1; child < end; ++count) {
+        if (is_object())
+            ++child;
+        child = Element(_document, child).next();
+    }
+    return count;
+}
+
+std::string_view LazyJson::Element::raw() const {
+    const auto& node = _document->_nodes[_node];
+    const std::string_view text = _document->_text;
+
+    if (is_string())
+        return text.substr(node.offset + 1, node.extent);
+    if (!is_object() && !is_array())
+        return text.substr(node.offset, node.extent);
+
+    // The container ends at the first closing bracket after its last value
+    std::size_t end = node.offset + 1;
+    if (node.extent > _node + 1) {
+        auto last = _node + 1;
+        for (auto child = last; child < node.extent; child = Element(_document, child).next()) {
+            if (is_object())
+                ++child;
+            last = child;
+        }
+        const auto last_raw = Element(_document, last).raw();
+        end = static_cast<std::size_t>(last_raw.data() - text.data()) + last_raw.size();
+    }
+    return text.substr(node.offset, text.find(is_object() ? '}' : ']', end) + 1 - node.offset);
+}
+
+const std::unordered_multimap<std::size_t, std::uint32_t>& LazyJson::key_table(std::size_t node) const {
+    std::lock_guard<std::mutex> lock(_key_tables->guard);
+    auto [table, inserted] = _key_tables->objects.try_emplace(node);
+    if (!inserted)
+        return table->second;
+
+    // Escaped keys are hashed decoded, through a single buffer
+    std::string decoded;
+    const Element object(this, node);
+    for (auto child = node + 1; child < object.next(); child = Element(this, child + 1).next()) {
+        auto key = Element(this, child).raw();
+        if (key.find('\\') != std::string_view::npos) {
+            decoded.clear();
+            JsonCursor::unescape(key, decoded);
+            key = decoded;
+        }
+        table->second.emplace(std::hash<std::string_view>()(key), static_cast<std::uint32_t>(child));
+    }
+    return table->second;
+}
+
+std::optional<LazyJson::Element> LazyJson::Element::find(std::string_view key) const {
+    if (!is_object())
+        return std::nullopt;
+
+    std::optional<Element> found;
+    const auto end = next();
+    if (end - _node > key_table_threshold) {
+        const auto [first, last] = _document->key_table(_node).equal_range(std::hash<std::string_view>()(key));
+        for (auto candidate = first; candidate != last; ++candidate) {
+            const auto child = std::size_t(candidate->second);
+            if ((!found || child + 1 > found->_node) && JsonCursor::unescaped_equals(Element(_document, child).raw(), key))
+                found = Element(_document, child + 1);
+        }
+        return found;
+    }
+
+    for (auto child = _node + 1; child < end; child = Element(_document, child + 1).next()) {
+        if (JsonCursor::unescaped_equals(Element(_document, child).raw(), key))
+            found = Element(_document, child + 1);
+    }
+    return found;
+}
+
+std::optional<LazyJson::Element> LazyJson::Element::find(std::size_t index) const {
+    if (!is_array())
+        return std::nullopt;
+
+    const auto end = next();
+    for (auto child = _node + 1; child < end; child = Element(_document, child).next()) {
+        if (index-- == 0)
+            return Element(_document, child);
+    }
+    return std::nullopt;
+}
+
+LazyJson::Element LazyJson::Element::at(std::string_view key) const {
+    if (!is_object())
+        throw bad_json_access("Not a JSON Object");
+
+    if (auto element = find(key))
+        return *element;
+    throw std::out_of_range("No such key");
+}
+
+LazyJson::Element LazyJson::Element::at(std::size_t index) const {
+    if (!is_array())
+        throw bad_json_access("Not a JSON Array");
+
+    if (auto element = find(index))
+        return *element;
+    throw std::out_of_range("Index is out of range");
+}
+
+bool LazyJson::Element::convert(Json::Value& value) const {
+    switch (kind()) {
+        case '{': {
+            Json::JsonObject object;
+            const auto end = next();
+            for (auto child = _node + 1; child < end; child = Element(_document, child + 1).next()) {
+                Json::Value member;
+                if (!Element(_document, child + 1).convert(member))
+                    return false;
+                object.insert_or_assign(JsonCursor::unescape(Element(_document, child).raw()), std::move(member));
+            }
+            value = Json(std::move(object));
+            return true;
+        }
+        case '[': {
+            Json::JsonArray array;
+            const auto end = next();
+            for (auto child = _node + 1; child < end; child = Element(_document, child).next()) {
+                if (!Element(_document, child).convert(array.emplace_back()))
+                    return false;
+            }
+            value = Json(std::move(array));
+            return true;
+        }
+        case '"':
+            value = JsonCursor::unescape(raw());
+            return true;
+        case 'n':
+            value = Json::Null();
+            return true;
+        case 't':
+            value = true;
+            return true;
+        case 'f':
+            value = false;
+            return true;
+        default: {
+            auto number = Json::parse_number(raw());
+            if (!number)
+                return false;
+            value = std::move(*number);
+            return true;
+        }
+    }
+}
+
+std::optional<Json::Value> LazyJson::Element::value() const {
+    std::optional<Json::Value> value(std::in_place);
+    if (!convert(*value))
+        return std::nullopt;
+    return value;
+}
+
+}
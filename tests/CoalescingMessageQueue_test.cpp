@@ -0,0 +1,84 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <MessageQueue/CoalescingMessageQueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+using namespace Core;
+
+TEST(CoalescingMessageQueue, can_retrieve_message)
+{
+    CoalescingMessageQueue<int, std::string> queue;
+    ASSERT_TRUE(queue.empty());
+
+    queue.push(1, "Hey there");
+    ASSERT_FALSE(queue.empty());
+
+    auto [key, message] = queue.take();
+    EXPECT_EQ(key, 1);
+    EXPECT_EQ(message, "Hey there");
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(CoalescingMessageQueue, latest_value_wins)
+{
+    CoalescingMessageQueue<std::string, int> queue;
+    for (int i = 0; i < 1000; ++i) {
+        queue.push("first", i);
+        queue.push("second", -i);
+    }
+
+    ASSERT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.take(), std::make_pair(std::string("first"), 999));
+    EXPECT_EQ(queue.take(), std::make_pair(std::string("second"), -999));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(CoalescingMessageQueue, replacement_keeps_position)
+{
+    CoalescingMessageQueue<int, std::string> queue;
+    queue.push(1, "one");
+    queue.push(2, "two");
+    queue.push(3, "three");
+    queue.push(1, "one, updated");
+
+    EXPECT_EQ(queue.take().second, "one, updated");
+    EXPECT_EQ(queue.take().second, "two");
+    EXPECT_EQ(queue.take().second, "three");
+}
+
+TEST(CoalescingMessageQueue, priority_matters)
+{
+    CoalescingMessageQueue<int, std::string> queue;
+    queue.push(MessagePriority::Low, 1, "!");
+    queue.push(MessagePriority::High, 2, "Hello");
+    queue.push(3, "world");
+    queue.push(static_cast<unsigned>(MessagePriority::Normal) + 1, 4, " ");
+    // the original priority is kept on replacement
+    queue.push(MessagePriority::High, 1, "!");
+
+    std::string result;
+    while (!queue.empty())
+        result += queue.take().second;
+    EXPECT_EQ(result, "Hello world!");
+}
+
+TEST(CoalescingMessageQueue, messages_can_be_waited_for)
+{
+    using namespace std::chrono_literals;
+
+    CoalescingMessageQueue<int, std::string> queue;
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(100ms);
+        queue.push(1, "delayed msg");
+    });
+
+    queue.wait_for_message();
+    EXPECT_EQ(queue.take().second, "delayed msg");
+    producer.join();
+}
@@ -0,0 +1,43 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/CompactJson.hpp>
+#include <Json/Json.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(CompactJsonBenchmark, compact_dom_memory_and_teardown)
+{
+    const auto document = nested_document(200, 2000);
+
+    auto heap_before = heap_usage();
+    auto json = std::make_unique<Json>(document);
+    const auto json_bytes = heap_usage() - heap_before;
+
+    heap_before = heap_usage();
+    auto compact = std::make_unique<CompactJson>(document);
+    const auto compact_bytes = heap_usage() - heap_before;
+
+    ASSERT_TRUE(json->valid());
+    ASSERT_TRUE(compact->valid());
+
+    const auto json_teardown_ms = measure_ms([&]() { json.reset(); });
+    const auto compact_teardown_ms = measure_ms([&]() { compact.reset(); });
+
+    TEST_INFO << "Text: " << document.size() << " bytes" << std::endl;
+    TEST_INFO << "Json: " << json_bytes << " bytes, teardown " << json_teardown_ms << " ms" << std::endl;
+    TEST_INFO << "CompactJson: " << compact_bytes << " bytes, teardown " << compact_teardown_ms << " ms"
+              << std::endl;
+    if (json_bytes > 0) {
+        EXPECT_LT(compact_bytes * 3, json_bytes);
+    }
+}
@@ -0,0 +1,89 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/CompactJson.hpp>
+#include <Json/Json.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace Core;
+
+namespace {
+const std::string document = "{\n"
+                             "  \"name\": \"John \\\"Jr\\\"\",\n"
+                             "  \"age\": 25,\n"
+                             "  \"big\": 9007199254740993,\n"
+                             "  \"height\": 1.85,\n"
+                             "  \"address\": {\"city\": \"New York\", \"zip\": null, \"empty\": {}},\n"
+                             "  \"phones\": [{\"type\": \"home\"}, {\"type\": \"fax\"}, []],\n"
+                             "  \"active\": true,\n"
+                             "  \"active\": false\n"
+                             "}";
+}
+
+TEST(CompactJson, gets_values)
+{
+    const CompactJson json(document);
+    ASSERT_TRUE(json.valid());
+
+    EXPECT_EQ(json.get<std::string_view>("name"), "John \"Jr\"");
+    EXPECT_EQ(json.get<int>("age"), 25);
+    EXPECT_EQ(json.get<double>("age"), 25.0);
+    EXPECT_EQ(json.get<std::int64_t>("big"), 9007199254740993);
+    EXPECT_FALSE(json.get<int>("big"));
+    EXPECT_EQ(json.get<double>("height"), 1.85);
+    EXPECT_FALSE(json.get<int>("height"));
+    EXPECT_EQ(json.get<std::string>("address.city"), "New York");
+    EXPECT_TRUE(json.find_path("address.zip")->is_null());
+    EXPECT_EQ(json.get<std::string_view>("phones[1].type"), "fax");
+    EXPECT_EQ(json.get<bool>("active"), false);
+    EXPECT_FALSE(json.find_path("phones[3]"));
+    EXPECT_FALSE(json.find_path("address.country"));
+}
+
+TEST(CompactJson, elements)
+{
+    const CompactJson json(document);
+
+    const auto phones = json.root().at("phones");
+    EXPECT_TRUE(phones.is_array());
+    EXPECT_EQ(phones.size(), 3u);
+    EXPECT_EQ(phones.at(0).at("type").get<std::string_view>(), "home");
+    EXPECT_EQ(phones.at(2).size(), 0u);
+
+    const auto address = json.root().at("address");
+    const auto [key, value] = address.member(1);
+    EXPECT_EQ(key, "zip");
+    EXPECT_TRUE(value.is_null());
+
+    EXPECT_THROW(phones.at("type"), bad_json_access);
+    EXPECT_THROW(phones.at(3), std::out_of_range);
+    EXPECT_THROW(address.member(3), std::out_of_range);
+}
+
+TEST(CompactJson, converts_to_json)
+{
+    const CompactJson json(document);
+    EXPECT_EQ(json.to_json(), Json(document));
+    EXPECT_EQ(CompactJson("[]").to_json(), Json("[]"));
+
+    // Deeply nested subtrees are moved into their parents level by level
+    const auto nested = std::string(1000, '[') + "{\"a\": [1, 2.5, \"x\"]}" + std::string(1000, ']');
+    EXPECT_EQ(CompactJson(nested).to_json(), Json(nested));
+}
+
+TEST(CompactJson, validates)
+{
+    for (const std::string text : {"", "1", "{", "{\"a\": }", "[1, 2,]", "[\"\\x\"]", "[1] 2", "{\"a\": tru}",
+                                   "[99999999999999999999]"}) {
+        const CompactJson json(text);
+        EXPECT_FALSE(json.valid()) << text;
+        EXPECT_EQ(json.size(), 0u);
+        EXPECT_THROW(json.root(), bad_json_access);
+    }
+}
@@ -0,0 +1,61 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/FlatObject.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(FlatObjectBenchmark, flat_object_against_map)
+{
+    for (const int size : {4, 64, 10000}) {
+        std::vector<std::string> keys;
+        for (int i = 0; i < size; ++i)
+            keys.push_back("member_" + std::to_string(i * 7919 % 10007));
+
+        FlatObject<int> flat;
+        std::map<std::string, int, std::less<>> map;
+        for (int i = 0; i < size; ++i) {
+            flat.emplace(keys[i], i);
+            map.emplace(keys[i], i);
+        }
+
+        const int rounds = 1000000 / size;
+        long long sum = 0;
+        const auto flat_find_ms = measure_ms([&]() {
+            for (int round = 0; round < rounds; ++round)
+                for (const auto& key : keys)
+                    sum += flat.find(key)->second;
+        });
+        const auto map_find_ms = measure_ms([&]() {
+            for (int round = 0; round < rounds; ++round)
+                for (const auto& key : keys)
+                    sum -= map.find(key)->second;
+        });
+        const auto flat_iterate_ms = measure_ms([&]() {
+            for (int round = 0; round < rounds; ++round)
+                for (const auto& member : flat)
+                    sum += member.second;
+        });
+        const auto map_iterate_ms = measure_ms([&]() {
+            for (int round = 0; round < rounds; ++round)
+                for (const auto& member : map)
+                    sum -= member.second;
+        });
+
+        TEST_INFO << size << " keys, lookup flat: " << flat_find_ms << " ms, map: " << map_find_ms
+                  << " ms; iteration flat: " << flat_iterate_ms << " ms, map: " << map_iterate_ms << " ms"
+                  << std::endl;
+        EXPECT_EQ(sum, 0);
+    }
+}
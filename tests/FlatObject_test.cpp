@@ -0,0 +1,105 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/FlatObject.hpp>
+#include <Json/Json.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+TEST(FlatObject, keeps_insertion_order)
+{
+    FlatObject<int> object;
+    EXPECT_TRUE(object.empty());
+    object["zebra"] = 1;
+    object.emplace("apple", 2);
+    object.insert_or_assign("mango", 3);
+    EXPECT_FALSE(object.emplace("zebra", 4).second);
+    EXPECT_FALSE(object.insert_or_assign("apple", 5).second);
+
+    std::vector<std::string> keys;
+    for (const auto& [key, value] : object)
+        keys.push_back(key);
+    EXPECT_EQ(keys, (std::vector<std::string>{"zebra", "apple", "mango"}));
+    EXPECT_EQ(object.at("zebra"), 1);
+    EXPECT_EQ(object.at("apple"), 5);
+    EXPECT_THROW(object.at("kiwi"), std::out_of_range);
+    EXPECT_EQ(object.find("kiwi"), object.end());
+}
+
+TEST(FlatObject, finds_keys_of_large_objects)
+{
+    FlatObject<int> object;
+    for (int i = 0; i < 5000; ++i)
+        object.emplace("key" + std::to_string(i), i);
+    ASSERT_EQ(object.size(), 5000u);
+
+    for (int i = 0; i < 5000; ++i) {
+        auto it = object.find("key" + std::to_string(i));
+        ASSERT_NE(it, object.end());
+        EXPECT_EQ(it->second, i);
+        EXPECT_EQ(it - object.begin(), i);
+    }
+    EXPECT_EQ(object.find("key5000"), object.end());
+
+    for (int i = 0; i < 5000; i += 2)
+        EXPECT_EQ(object.erase("key" + std::to_string(i)), 1u);
+    EXPECT_EQ(object.erase("key0"), 0u);
+    ASSERT_EQ(object.size(), 2500u);
+    EXPECT_EQ(object.begin()->first, "key1");
+    EXPECT_EQ(object.at("key4999"), 4999);
+    EXPECT_EQ(object.find("key4998"), object.end());
+    for (int i = 1; i < 5000; i += 2)
+        EXPECT_EQ(object.find("key" + std::to_string(i)) - object.begin(), i / 2);
+}
+
+TEST(FlatObject, erasing_keeps_the_index_consistent)
+{
+    FlatObject<int> object;
+    std::vector<std::string> expected;
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 50; ++i) {
+            const auto key = std::to_string(round * 50 + i);
+            object.emplace(key, round * 50 + i);
+            expected.push_back(key);
+        }
+        // Remove a third of the members, spread over the whole object
+        for (std::size_t i = 0; i < expected.size(); i += 2) {
+            ASSERT_EQ(object.erase(expected[i]), 1u);
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+
+    ASSERT_EQ(object.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        const auto it = object.find(expected[i]);
+        ASSERT_NE(it, object.end()) << expected[i];
+        EXPECT_EQ(static_cast<std::size_t>(it - object.begin()), i);
+        EXPECT_EQ(std::to_string(it->second), expected[i]);
+    }
+}
+
+TEST(FlatObject, equality_ignores_order)
+{
+    FlatObject<int> first;
+    FlatObject<int> second;
+    first["a"] = 1;
+    first["b"] = 2;
+    second["b"] = 2;
+    second["a"] = 1;
+    EXPECT_EQ(first, second);
+
+    second["a"] = 3;
+    EXPECT_NE(first, second);
+    second.erase("a");
+    EXPECT_NE(first, second);
+
+    EXPECT_EQ(Json("{\"a\": 1, \"b\": [2]}"), Json("{\"b\": [2], \"a\": 1}"));
+}
@@ -0,0 +1,65 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_JSONBENCHMARK_HPP
+#define CORE_JSONBENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define CORE_HAS_MALLINFO2 1
+#endif
+
+namespace JsonBenchmark {
+
+/// \brief Milliseconds it takes to run \param function.
+template<class Function>
+double measure_ms(Function&& function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// \brief Fewest milliseconds it takes to run \param function out of \param runs.
+/// Timing assertions compare these, a single run is easily slowed down by the machine.
+template<class Function>
+double best_of_ms(int runs, Function&& function) {
+    auto best = measure_ms(function);
+    for (int run = 1; run < runs; ++run)
+        best = std::min(best, measure_ms(function));
+    return best;
+}
+
+/// \brief Object and array nested \param depth times, every level holds \param width values.
+inline std::string nested_document(int depth, int width) {
+    std::string document;
+    for (int i = 0; i < depth; ++i) {
+        document += "{\"key\": [";
+        for (int j = 0; j < width; ++j)
+            document += "1.5, \"abc\", true, ";
+    }
+    document += "null";
+    for (int i = 0; i < depth; ++i)
+        document += "]}";
+    return document;
+}
+
+/// \brief Bytes allocated on the heap, 0 if it can not be told.
+inline std::size_t heap_usage() {
+#if defined(CORE_HAS_MALLINFO2)
+    // Large blocks are mapped by malloc, they are not counted as part of the heap
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+}
+
+#endif //CORE_JSONBENCHMARK_HPP
@@ -0,0 +1,92 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonBinding.hpp>
+#include <Json/JsonWriter.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+namespace {
+struct Order {
+    long long id = 0;
+    std::string customer;
+    double total = 0;
+    bool paid = false;
+    std::vector<int> items;
+};
+}
+
+template<>
+struct Core::JsonBinding<Order> {
+    static constexpr auto fields = std::make_tuple(CORE_JSON_FIELD(Order, id), CORE_JSON_FIELD(Order, customer),
+                                                   CORE_JSON_FIELD(Order, total), CORE_JSON_FIELD(Order, paid),
+                                                   CORE_JSON_FIELD(Order, items));
+};
+
+TEST(JsonBindingBenchmark, struct_binding_against_dom)
+{
+    const int count = 20000;
+    std::vector<Order> orders(count);
+    for (int i = 0; i < count; ++i)
+        orders[i] = {i * 7919LL, "customer " + std::to_string(i), i * 0.25, i % 2 == 0, {i, i + 1, i + 2}};
+
+    std::string bound_text;
+    const auto bound_write_ms = best_of_ms(3, [&]() { bound_text = JsonBinder::to_string(orders); });
+
+    std::string dom_text;
+    const auto dom_write_ms = best_of_ms(3, [&]() {
+        auto json = Json::create_array();
+        for (int i = 0; i < count; ++i) {
+            const auto prefix = "[" + std::to_string(i) + "].";
+            json.set(prefix + "id", orders[i].id);
+            json.set(prefix + "customer", orders[i].customer);
+            json.set(prefix + "total", orders[i].total);
+            json.set(prefix + "paid", orders[i].paid);
+            for (std::size_t j = 0; j < orders[i].items.size(); ++j)
+                json.set(prefix + "items[" + std::to_string(j) + "]", orders[i].items[j]);
+        }
+        dom_text = JsonWriter::to_string(json);
+    });
+    EXPECT_EQ(Json(bound_text), Json(dom_text));
+
+    std::optional<std::vector<Order>> bound_orders;
+    const auto bound_read_ms = best_of_ms(3, [&]() { bound_orders = JsonBinder::parse<std::vector<Order>>(bound_text); });
+
+    std::vector<Order> dom_orders(count);
+    const auto dom_read_ms = best_of_ms(3, [&]() {
+        const Json json(bound_text);
+        for (int i = 0; i < count; ++i) {
+            const auto prefix = "[" + std::to_string(i) + "].";
+            auto& order = dom_orders[i];
+            order.id = json.get<long long>(prefix + "id", json.get<int>(prefix + "id", 0));
+            order.customer = json.get<std::string>(prefix + "customer", "");
+            order.total = json.get<double>(prefix + "total", 0);
+            order.paid = json.get<bool>(prefix + "paid", false);
+            order.items.clear();
+            for (int j = 0; j < 3; ++j)
+                order.items.push_back(json.get<int>(prefix + "items[" + std::to_string(j) + "]", 0));
+        }
+    });
+
+    TEST_INFO << count << " structs, write bound: " << bound_write_ms << " ms, through the DOM: " << dom_write_ms
+              << " ms" << std::endl;
+    TEST_INFO << "Read bound: " << bound_read_ms << " ms, through the DOM: " << dom_read_ms << " ms" << std::endl;
+    ASSERT_TRUE(bound_orders);
+    EXPECT_EQ(JsonBinder::to_string(*bound_orders), bound_text);
+    EXPECT_EQ(JsonBinder::to_string(dom_orders), bound_text);
+    EXPECT_LT(bound_write_ms, dom_write_ms);
+    EXPECT_LT(bound_read_ms, dom_read_ms);
+}
@@ -0,0 +1,123 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonBinding.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+struct Address {
+    std::string city;
+    std::optional<int> zip;
+};
+
+struct Person {
+    std::string name;
+    int age = 0;
+    double height = 0;
+    bool active = false;
+    std::uint64_t id = 0;
+    std::vector<std::string> tags;
+    std::vector<Address> addresses;
+    std::optional<Address> work;
+};
+}
+
+template<>
+struct Core::JsonBinding<Address> {
+    static constexpr auto fields = std::make_tuple(CORE_JSON_FIELD(Address, city), CORE_JSON_FIELD(Address, zip));
+};
+
+template<>
+struct Core::JsonBinding<Person> {
+    static constexpr auto fields = std::make_tuple(
+            CORE_JSON_FIELD(Person, name), json_field("years", &Person::age), CORE_JSON_FIELD(Person, height),
+            CORE_JSON_FIELD(Person, active), CORE_JSON_FIELD(Person, id), CORE_JSON_FIELD(Person, tags),
+            CORE_JSON_FIELD(Person, addresses), CORE_JSON_FIELD(Person, work));
+};
+
+TEST(JsonBinding, writes_members)
+{
+    static_assert(is_json_bound<Person>::value);
+    static_assert(!is_json_bound<std::string>::value);
+
+    Person person{"Ann \"A\"", 41, 1.5, true, 4294967296u, {"x", "y"}, {{"Paris", 75001}, {"Rome", {}}}, {}};
+    const auto text = JsonBinder::to_string(person);
+    EXPECT_EQ(text, "{\"name\":\"Ann \\\"A\\\"\",\"years\":41,\"height\":1.5,\"active\":true,"
+                    "\"id\":4294967296,\"tags\":[\"x\",\"y\"],"
+                    "\"addresses\":[{\"city\":\"Paris\",\"zip\":75001},{\"city\":\"Rome\",\"zip\":null}],"
+                    "\"work\":null}");
+
+    // The same document as through the DOM
+    const Json json(text);
+    ASSERT_TRUE(json);
+    EXPECT_EQ(json.get<std::string>("addresses[0].city"), "Paris");
+    EXPECT_EQ(json.get<int>("years"), 41);
+
+    person.id = 18446744073709551615u;
+    EXPECT_NE(JsonBinder::to_string(person).find("\"id\":18446744073709551615,"), std::string::npos);
+}
+
+TEST(JsonBinding, reads_members)
+{
+    const auto person = JsonBinder::parse<Person>(
+            " {\"unknown\": {\"a\": [1, {\"b\": null}]}, \"n\\u0061me\": \"Bob\\n\", \"years\": 30, \"height\": 2,"
+            " \"tags\": [], \"addresses\": [{\"zip\": 10115, \"city\": \"Berlin\"}], \"work\": {\"city\": \"Oslo\"},"
+            " \"active\": false, \"id\": 7} ");
+    ASSERT_TRUE(person);
+    EXPECT_EQ(person->name, "Bob\n");
+    EXPECT_EQ(person->age, 30);
+    EXPECT_EQ(person->height, 2.0);
+    EXPECT_FALSE(person->active);
+    EXPECT_EQ(person->id, 7u);
+    EXPECT_TRUE(person->tags.empty());
+    ASSERT_EQ(person->addresses.size(), 1u);
+    EXPECT_EQ(person->addresses[0].city, "Berlin");
+    EXPECT_EQ(person->addresses[0].zip, 10115);
+    ASSERT_TRUE(person->work);
+    EXPECT_EQ(person->work->city, "Oslo");
+    EXPECT_FALSE(person->work->zip);
+
+    // Round trip
+    const auto again = JsonBinder::parse<Person>(JsonBinder::to_string(*person));
+    ASSERT_TRUE(again);
+    EXPECT_EQ(JsonBinder::to_string(*again), JsonBinder::to_string(*person));
+
+    // Missing members keep their values
+    Person defaults;
+    defaults.age = 5;
+    ASSERT_TRUE(JsonBinder::read("{\"name\": \"C\"}", defaults));
+    EXPECT_EQ(defaults.age, 5);
+
+    std::vector<int> numbers;
+    ASSERT_TRUE(JsonBinder::read("[1, -2, 3]", numbers));
+    EXPECT_EQ(numbers, (std::vector<int>{1, -2, 3}));
+
+    std::vector<float> floats;
+    ASSERT_TRUE(JsonBinder::read("[0.5, -2e3, 0]", floats));
+    EXPECT_EQ(floats, (std::vector<float>{0.5f, -2e3f, 0.0f}));
+    EXPECT_FALSE(JsonBinder::read("[1e39]", floats));
+    EXPECT_FALSE(JsonBinder::read("[1e-50]", floats));
+}
+
+TEST(JsonBinding, rejects_mismatches)
+{
+    const std::vector<std::string> invalid{
+        "{\"years\": \"30\"}", "{\"years\": 1.5}", "{\"years\": 3000000000}", "{\"id\": -1}", "{\"height\": 1e999}",
+        "{\"name\": 1}", "{\"active\": 1}", "{\"tags\": [1]}", "{\"work\": []}", "{\"unknown\": [1,]}",
+        "{\"name\": \"a\",}", "{\"name\": \"a\"} x", "[]", "",
+        "{\"unknown\": " + std::string(2000, '[') + std::string(2000, ']') + "}",
+    };
+    for (const auto& text : invalid)
+        EXPECT_FALSE(JsonBinder::parse<Person>(text)) << text.substr(0, 30);
+}
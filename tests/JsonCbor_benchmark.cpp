@@ -0,0 +1,52 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonCbor.hpp>
+#include <Json/JsonWriter.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonCborBenchmark, cbor_against_text)
+{
+    std::string document = "[";
+    for (int i = 0; i < 50000; ++i) {
+        document += "{\"id\": " + std::to_string(i * 7919) + ", \"name\": \"user" + std::to_string(i)
+                    + "\", \"score\": " + std::to_string(i) + ".37, \"ratio\": 0.5, \"active\": true,"
+                    " \"tags\": [\"a\", \"b\"], \"counts\": [1, 20, 300, 4000]}, ";
+    }
+    document += "null]";
+    const Json json(document);
+    ASSERT_TRUE(json.valid());
+
+    std::string text;
+    std::vector<std::uint8_t> binary;
+    const auto write_ms = measure_ms([&]() { text = JsonWriter::to_string(json); });
+    const auto encode_ms = measure_ms([&]() { binary = JsonCbor::encode(json); });
+
+    std::optional<Json> from_text;
+    std::optional<Json> from_binary;
+    const auto parse_ms = best_of_ms(3, [&]() { from_text.emplace(text); });
+    const auto decode_ms = best_of_ms(3, [&]() { from_binary = JsonCbor::decode(binary); });
+
+    TEST_INFO << "Text: " << text.size() << " bytes, written in " << write_ms << " ms, parsed in " << parse_ms
+              << " ms" << std::endl;
+    TEST_INFO << "CBOR: " << binary.size() << " bytes, encoded in " << encode_ms << " ms, decoded in " << decode_ms
+              << " ms" << std::endl;
+    ASSERT_TRUE(from_binary);
+    EXPECT_EQ(*from_binary, *from_text);
+    EXPECT_LT(binary.size(), text.size());
+    EXPECT_LT(decode_ms, parse_ms);
+}
@@ -0,0 +1,120 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonCbor.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+using Bytes = std::vector<std::uint8_t>;
+}
+
+TEST(JsonCbor, encodes_rfc_examples)
+{
+    EXPECT_EQ(JsonCbor::encode(Json("[1, [2, 3], [4, 5]]")), (Bytes{0x83, 0x01, 0x82, 0x02, 0x03, 0x82, 0x04, 0x05}));
+    EXPECT_EQ(JsonCbor::encode(Json("{\"a\": 1, \"b\": [2, 3]}")),
+              (Bytes{0xa2, 0x61, 0x61, 0x01, 0x61, 0x62, 0x82, 0x02, 0x03}));
+    EXPECT_EQ(JsonCbor::encode(Json("[-1000, 1000000, false, true, null, \"\"]")),
+              (Bytes{0x86, 0x39, 0x03, 0xe7, 0x1a, 0x00, 0x0f, 0x42, 0x40, 0xf4, 0xf5, 0xf6, 0x60}));
+    EXPECT_EQ(JsonCbor::encode(Json("[1.5, 1.1]")),
+              (Bytes{0x82, 0xfa, 0x3f, 0xc0, 0x00, 0x00, 0xfb, 0x3f, 0xf1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a}));
+}
+
+TEST(JsonCbor, round_trips_every_value_type)
+{
+    const auto max_long_long = std::to_string(std::numeric_limits<long long>::max());
+    const auto min_long_long = std::to_string(std::numeric_limits<long long>::min());
+    const Json json("{\"null\": null, \"bool\": [true, false], \"int\": [0, 23, 24, -24, -25, 2147483647],"
+                    " \"long\": [4294967296, " + max_long_long + ", " + min_long_long + "],"
+                    " \"double\": [1.0, -0.0, 0.1, 1e300, 5e-324],"
+                    " \"string\": \"caf\xc3\xa9 \\\"quoted\\\" " + std::string(300, 'x') + "\","
+                    " \"nested\": {\"empty\": {}, \"array\": [[], [{}]]}}");
+    ASSERT_TRUE(json);
+
+    const auto encoded = JsonCbor::encode(json);
+    const auto decoded = JsonCbor::decode(encoded);
+    ASSERT_TRUE(decoded);
+    EXPECT_EQ(*decoded, json);
+    EXPECT_TRUE(decoded->get<double>("double[0]"));
+    EXPECT_EQ(decoded->get<long long>("long[1]"), json.get<long long>("long[1]"));
+
+    // long long values keep their type within 32 bits, other widths are not kept
+    auto widths = Json::create_array();
+    widths.push_back(5LL);
+    widths.push_back(-4294967296LL);
+    widths.push_back(5L);
+    widths.push_back(std::numeric_limits<long long>::max());
+    const auto encoded_widths = JsonCbor::encode(widths);
+    EXPECT_EQ(Bytes(encoded_widths.begin(), encoded_widths.begin() + 10),
+              (Bytes{0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05}));
+    const auto decoded_widths = JsonCbor::decode(encoded_widths);
+    ASSERT_TRUE(decoded_widths);
+    EXPECT_TRUE((*decoded_widths)[0].is<long long>());
+    EXPECT_TRUE((*decoded_widths)[1].is<long long>());
+    EXPECT_TRUE((*decoded_widths)[2].is<int>());
+    if (sizeof(long) == sizeof(long long)) {
+        EXPECT_TRUE((*decoded_widths)[3].is<long>());
+    }
+
+    Bytes appended{0x00};
+    JsonCbor::encode(json, appended);
+    EXPECT_EQ(appended.size(), encoded.size() + 1);
+}
+
+TEST(JsonCbor, decodes_other_encodings)
+{
+    // Indefinite lengths
+    const auto indefinite = JsonCbor::decode(Bytes{0x9f, 0x01, 0x82, 0x02, 0x03, 0x9f, 0x04, 0x05, 0xff, 0xff});
+    ASSERT_TRUE(indefinite);
+    EXPECT_EQ(*indefinite, Json("[1, [2, 3], [4, 5]]"));
+
+    const auto indefinite_map = JsonCbor::decode(Bytes{0xbf, 0x7f, 0x61, 0x61, 0x62, 0x62, 0x63, 0xff, 0x01, 0xff});
+    ASSERT_TRUE(indefinite_map);
+    EXPECT_EQ(*indefinite_map, Json("{\"abc\": 1}"));
+
+    // Half precision floats, non-preferred integer lengths and tags
+    const auto other = JsonCbor::decode(Bytes{0x85, 0xf9, 0x3c, 0x00, 0xf9, 0xc4, 0x00, 0xf9, 0x7c, 0x00,
+                                              0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+                                              0xc1, 0x1a, 0x51, 0x4b, 0x67, 0xb0});
+    ASSERT_TRUE(other);
+    EXPECT_EQ(other->get<double>("[0]"), 1.0);
+    EXPECT_EQ(other->get<double>("[1]"), -4.0);
+    EXPECT_TRUE(std::isinf(*other->get<double>("[2]")));
+    EXPECT_EQ(other->get<long long>("[3]"), 5);  // the 8-byte argument of long long
+    EXPECT_EQ(other->get<int>("[4]"), 1363896240);
+}
+
+TEST(JsonCbor, rejects_invalid_data)
+{
+    const std::vector<Bytes> invalid{
+        {},
+        {0x01},                                     // not a container
+        {0x82, 0x01},                               // truncated
+        {0x81, 0x01, 0x01},                         // trailing bytes
+        {0x81, 0x41, 0x00},                         // byte string
+        {0xa1, 0x01, 0x01},                         // non-string key
+        {0x81, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},  // out of long long
+        {0x81, 0xf7},                               // undefined
+        {0x81, 0x1c},                               // reserved additional information
+        {0x9f, 0x01},                               // unterminated indefinite array
+        {0x81, 0x7f, 0x41, 0x00, 0xff},             // byte string chunk in text string
+        {0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},  // bogus size
+    };
+    for (const auto& bytes : invalid)
+        EXPECT_FALSE(JsonCbor::decode(bytes)) << bytes.size() << " bytes";
+
+    Bytes deep(2000, 0x81);
+    deep.push_back(0x80);
+    EXPECT_FALSE(JsonCbor::decode(deep));
+}
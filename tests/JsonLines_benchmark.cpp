@@ -0,0 +1,70 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonLines.hpp>
+#include <Json/JsonWriter.hpp>
+#include <ThreadPool/ThreadPool.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+namespace {
+/// \brief Records per second of reading \param text on a pool of \tparam N threads.
+template<unsigned N>
+double json_lines_throughput(const std::string& text, std::size_t lines) {
+    ThreadPool<N> pool;
+    std::size_t valid = 0;
+    const auto ms = measure_ms([&]() {
+        JsonLines::read(text, pool, [&valid](Json&& record) { valid += record.valid(); });
+    });
+    EXPECT_EQ(valid, lines);
+    return lines / ms * 1000;
+}
+}
+
+TEST(JsonLinesBenchmark, json_lines_scaling)
+{
+    const std::size_t lines = 200000;
+    std::string text;
+    {
+        JsonWriter writer;
+        for (std::size_t i = 0; i < lines; ++i) {
+            writer.write(Json("{\"id\": " + std::to_string(i) + ", \"level\": \"info\", \"message\": \"request served\","
+                              " \"latency\": 12.5, \"tags\": [\"api\", \"v2\"], \"ok\": true}")).write_raw("\n");
+        }
+        text = writer.take();
+    }
+
+    // One line at a time on one thread
+    std::size_t valid = 0;
+    const auto serial_ms = measure_ms([&]() {
+        std::istringstream stream(text);
+        for (std::string line; std::getline(stream, line);)
+            valid += Json(line).valid();
+    });
+    ASSERT_EQ(valid, lines);
+
+    TEST_INFO << text.size() << " bytes, one line at a time: " << lines / serial_ms * 1000 << " records/s" << std::endl;
+    const auto one = json_lines_throughput<1>(text, lines);
+    TEST_INFO << "Pool of 1: " << one << " records/s" << std::endl;
+    TEST_INFO << "Pool of 2: " << json_lines_throughput<2>(text, lines) << " records/s" << std::endl;
+    const auto four = json_lines_throughput<4>(text, lines);
+    TEST_INFO << "Pool of 4: " << four << " records/s" << std::endl;
+    TEST_INFO << "Pool of 8: " << json_lines_throughput<8>(text, lines) << " records/s" << std::endl;
+    // Scaling can only be told with as many cores as workers
+    if (std::thread::hardware_concurrency() >= 4) {
+        EXPECT_GT(four, one * 1.5);
+    }
+}
@@ -0,0 +1,150 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonLines.hpp>
+#include <ThreadPool/ThreadPool.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+/// \brief \param count lines of {"id": <line>}, with blank lines in between.
+std::string numbered_lines(int count) {
+    std::string text;
+    for (int i = 0; i < count; ++i) {
+        text += "{\"id\": " + std::to_string(i) + "}\n";
+        if (i % 10 == 0)
+            text += "  \r\n";
+    }
+    return text;
+}
+}
+
+TEST(JsonLines, splits_at_line_ends)
+{
+    const std::string text = "[1]\n[2, 3]\n[4]\n[5]";
+    const auto chunks = JsonLines::split(text, 5);
+    EXPECT_EQ(chunks, (std::vector<std::string_view>{"[1]\n[2, 3]\n", "[4]\n[5]"}));
+    EXPECT_EQ(JsonLines::split(text, 1).size(), 4u);
+    EXPECT_EQ(JsonLines::split(text, 100).size(), 1u);
+    EXPECT_TRUE(JsonLines::split("", 100).empty());
+
+    std::vector<Json> records;
+    JsonLines::parse("[1]\r\n\n{\"a\": 2}\n[oops]\n  \n[3]", records);
+    ASSERT_EQ(records.size(), 4u);
+    EXPECT_EQ(records[0], Json("[1]"));
+    EXPECT_EQ(records[1].get<int>("a"), 2);
+    EXPECT_FALSE(records[2].valid());
+    EXPECT_EQ(records[3], Json("[3]"));
+}
+
+TEST(JsonLines, reads_in_order)
+{
+    ThreadPool<4> pool;
+    const auto text = numbered_lines(5000);
+
+    std::vector<int> ids;
+    const auto count = JsonLines::read(text, pool, [&ids](Json&& record) {
+        ids.push_back(record.get<int>("id", -1));
+    }, {64, JsonLines::Order::Ordered});
+
+    ASSERT_EQ(count, 5000u);
+    ASSERT_EQ(ids.size(), 5000u);
+    for (int i = 0; i < 5000; ++i)
+        ASSERT_EQ(ids[i], i);
+}
+
+TEST(JsonLines, reads_unordered)
+{
+    ThreadPool<4> pool;
+    const auto text = numbered_lines(5000);
+
+    std::vector<int> ids;
+    const auto count = JsonLines::read(text, pool, [&ids](Json&& record) {
+        ids.push_back(record.get<int>("id", -1));
+    }, {64, JsonLines::Order::Unordered});
+
+    ASSERT_EQ(count, 5000u);
+    std::sort(ids.begin(), ids.end());
+    for (int i = 0; i < 5000; ++i)
+        ASSERT_EQ(ids[i], i);
+}
+
+TEST(JsonLines, callback_exceptions_propagate)
+{
+    ThreadPool<2> pool;
+    const auto text = numbered_lines(1000);
+
+    int delivered = 0;
+    EXPECT_THROW(JsonLines::read(text, pool, [&delivered](Json&&) {
+        if (++delivered == 100)
+            throw std::runtime_error("stop");
+    }, {32, JsonLines::Order::Ordered}), std::runtime_error);
+    EXPECT_EQ(delivered, 100);
+
+    // A stopped pool does not take jobs, the chunks are parsed on the calling thread
+    pool.stop();
+    EXPECT_EQ(JsonLines::read(text, pool, [](Json&&) {}), 1000u);
+    EXPECT_FALSE(JsonLines::read_file("/nonexistent/lines.ndjson", pool, [](Json&&) {}));
+}
+
+TEST(JsonLines, reads_when_queued_jobs_never_run)
+{
+    const auto text = numbered_lines(1000);
+
+    // Without workers the calling thread parses every chunk
+    ThreadPool<0> idle;
+    EXPECT_EQ(JsonLines::read(text, idle, [](Json&&) {}, {32, JsonLines::Order::Unordered}), 1000u);
+    EXPECT_EQ(JsonLines::read(text, idle, [](Json&&) {}, {32, JsonLines::Order::Ordered}), 1000u);
+
+    // The only worker is busy and the pool is stopped while chunks are queued
+    ThreadPool<1> pool;
+    std::promise<void> release;
+    pool.add_job([blocked = release.get_future().share()]() { blocked.wait(); });
+
+    std::vector<int> ids;
+    const auto count = JsonLines::read(text, pool, [&](Json&& record) {
+        if (ids.empty())
+            pool.stop();
+        ids.push_back(record.get<int>("id", -1));
+    }, {32, JsonLines::Order::Ordered});
+    release.set_value();
+
+    EXPECT_EQ(count, 1000u);
+    ASSERT_EQ(ids.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(ids[i], i);
+}
+
+TEST(JsonLines, writes_batches)
+{
+    std::ostringstream stream;
+    {
+        JsonLinesWriter writer(stream, 32);
+        writer.write(Json("{\"id\": 1, \"text\": \"a\\nb\"}"));
+        EXPECT_TRUE(stream.str().empty());
+        writer.write(Json("[1, 2]"));
+        EXPECT_TRUE(stream.str().empty());
+        writer.write(Json("{}"));
+        EXPECT_EQ(stream.str(), "{\"id\":1,\"text\":\"a\\nb\"}\n[1,2]\n{}\n");
+        writer.write(Json("[]"));
+    }
+    EXPECT_EQ(stream.str(), "{\"id\":1,\"text\":\"a\\nb\"}\n[1,2]\n{}\n[]\n");
+
+    ThreadPool<2> pool;
+    std::vector<Json> records;
+    JsonLines::read(stream.str(), pool, [&records](Json&& record) { records.push_back(std::move(record)); });
+    ASSERT_EQ(records.size(), 4u);
+    EXPECT_EQ(records[0].get<std::string>("text"), "a\nb");
+}
@@ -0,0 +1,66 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonParallelParser.hpp>
+#include <ThreadPool/ThreadPool.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <thread>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+namespace {
+/// \brief Milliseconds of parsing \param text on a pool of \tparam N threads.
+template<unsigned N>
+double parallel_parse_ms(const std::string& text, const Json& expected) {
+    ThreadPool<N> pool;
+    std::optional<Json> json;
+    const auto ms = measure_ms([&]() { json.emplace(JsonParallelParser::parse(text, pool)); });
+    EXPECT_EQ(*json, expected);
+    TEST_INFO << "Pool of " << N << ": " << ms << " ms" << std::endl;
+    return ms;
+}
+}
+
+TEST(JsonParallelParserBenchmark, parallel_array_parse_scaling)
+{
+    std::string text = "[";
+    for (int i = 0; i < 200000; ++i) {
+        text += "{\"id\": " + std::to_string(i) + ", \"name\": \"item \\\"" + std::to_string(i)
+                + "\\\"\", \"price\": 19.99, \"tags\": [\"a\", \"b\"], \"stock\": null}, ";
+    }
+    text += "{}]";
+
+    std::optional<Json> serial;
+    const auto serial_ms = measure_ms([&]() { serial.emplace(Json::parse(text)); });
+    ASSERT_TRUE(serial->valid());
+
+    std::optional<JsonParallelParser::Split> split;
+    const auto split_ms = measure_ms([&]() { split = JsonParallelParser::split(text, 1 << 16); });
+    ASSERT_TRUE(split);
+    EXPECT_EQ(split->size, 200001u);
+
+    TEST_INFO << text.size() << " bytes, serial parse: " << serial_ms << " ms, scan for elements: " << split_ms
+              << " ms (" << text.size() / split_ms / 1000 << " MB/s)" << std::endl;
+    const auto one = parallel_parse_ms<1>(text, *serial);
+    parallel_parse_ms<2>(text, *serial);
+    const auto four = parallel_parse_ms<4>(text, *serial);
+    parallel_parse_ms<8>(text, *serial);
+    parallel_parse_ms<16>(text, *serial);
+    parallel_parse_ms<32>(text, *serial);
+
+    EXPECT_LT(split_ms, serial_ms / 4);
+    // Scaling can only be told with as many cores as workers
+    if (std::thread::hardware_concurrency() >= 4) {
+        EXPECT_LT(four, one / 1.5);
+    }
+}
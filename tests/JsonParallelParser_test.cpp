@@ -0,0 +1,108 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonParallelParser.hpp>
+#include <ThreadPool/ThreadPool.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+TEST(JsonParallelParser, splits_top_level_elements)
+{
+    const std::string text = " [1, \"a,]\\\"[\", [2, 3], {\"b\": \"}\"}, null] \n";
+    const auto split = JsonParallelParser::split(text, 4);
+    ASSERT_TRUE(split);
+    EXPECT_EQ(split->size, 5u);
+    ASSERT_EQ(split->chunks.size(), 4u);
+    EXPECT_EQ(split->chunks[0].text, "1, \"a,]\\\"[\"");
+    EXPECT_EQ(split->chunks[0].count, 2u);
+    EXPECT_EQ(split->chunks[1].text, " [2, 3]");
+    EXPECT_EQ(split->chunks[1].first, 2u);
+    EXPECT_EQ(split->chunks[2].text, " {\"b\": \"}\"}");
+    EXPECT_EQ(split->chunks[3].text, " null");
+    EXPECT_EQ(split->chunks[3].first, 4u);
+
+    const auto one_chunk = JsonParallelParser::split(text, 1000);
+    ASSERT_TRUE(one_chunk);
+    EXPECT_EQ(one_chunk->chunks.size(), 1u);
+    EXPECT_EQ(one_chunk->size, 5u);
+
+    const auto empty = JsonParallelParser::split("[ ]", 1);
+    ASSERT_TRUE(empty);
+    EXPECT_EQ(empty->size, 0u);
+
+    EXPECT_FALSE(JsonParallelParser::split("{\"a\": [1, 2]}", 1));
+    EXPECT_FALSE(JsonParallelParser::split("[1, 2", 1));
+    EXPECT_FALSE(JsonParallelParser::split("[1, \"2]", 1));
+    EXPECT_FALSE(JsonParallelParser::split("[1, 2}", 1));
+    EXPECT_FALSE(JsonParallelParser::split("[1, 2] 3", 1));
+}
+
+TEST(JsonParallelParser, matches_the_serial_parser)
+{
+    ThreadPool<4> pool;
+    std::string text = "[";
+    for (int i = 0; i < 3000; ++i) {
+        text += "{\"id\": " + std::to_string(i) + ", \"name\": \"n\\\"" + std::to_string(i)
+                + "]\", \"values\": [1.5, true, null, [" + std::to_string(-i) + "]]}, \"s,{\", ";
+    }
+    text += "[]]";
+
+    const auto serial = Json::parse(text);
+    ASSERT_TRUE(serial);
+    for (const std::size_t chunk_size : {1, 100, 4096, 1 << 20}) {
+        const auto parallel = JsonParallelParser::parse(text, pool, chunk_size);
+        ASSERT_TRUE(parallel) << chunk_size;
+        EXPECT_EQ(parallel, serial) << chunk_size;
+        EXPECT_EQ(parallel.size(), 6001u);
+        EXPECT_EQ(parallel.get<std::string>("[2998].name"), "n\"1499]");
+    }
+
+    EXPECT_EQ(JsonParallelParser::parse("[]", pool), Json("[]"));
+    EXPECT_EQ(JsonParallelParser::parse("{\"a\": [1]}", pool), Json("{\"a\": [1]}"));
+}
+
+TEST(JsonParallelParser, rejects_invalid_documents)
+{
+    ThreadPool<2> pool;
+    const std::vector<std::string> invalid{
+        "[1, 2,]", "[, 1]", "[1,, 2]", "[1 2]", "[{]", "[[1}, 2]", "[\"a\\x\"]", "[1] x", "[1}", "{", "",
+        std::string(2000, '[') + std::string(2000, ']'),
+    };
+    for (const auto& text : invalid) {
+        EXPECT_FALSE(JsonParallelParser::parse(text, pool, 1)) << text.substr(0, 20);
+        EXPECT_FALSE(Json::parse(text)) << text.substr(0, 20);
+    }
+
+    // A stopped pool does not take jobs, the chunks are parsed on the calling thread
+    pool.stop();
+    EXPECT_EQ(JsonParallelParser::parse("[1, [2], {\"a\": 3}]", pool, 1), Json("[1, [2], {\"a\": 3}]"));
+}
+
+TEST(JsonParallelParser, parses_when_queued_jobs_never_run)
+{
+    std::string text = "[";
+    for (int i = 0; i < 1000; ++i)
+        text += (i ? ", {\"id\": " : "{\"id\": ") + std::to_string(i) + "}";
+    text += "]";
+
+    // Without workers the calling thread parses every chunk
+    ThreadPool<0> idle;
+    EXPECT_EQ(JsonParallelParser::parse(text, idle, 64), Json(text));
+
+    // The only worker is busy, the chunks queued behind it are parsed on the calling thread
+    ThreadPool<1> pool;
+    std::promise<void> release;
+    pool.add_job([blocked = release.get_future().share()]() { blocked.wait(); });
+    EXPECT_EQ(JsonParallelParser::parse(text, pool, 64), Json(text));
+    pool.stop();
+    release.set_value();
+}
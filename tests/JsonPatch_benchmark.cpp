@@ -0,0 +1,55 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonPatch.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonPatchBenchmark, patch_in_place_against_copy)
+{
+    const auto document_text = nested_document(200, 2000);
+    auto document = Json::parse(document_text);
+    ASSERT_TRUE(document.valid());
+
+    // Replace a value 100 levels deep, the nested object is the last element of each array
+    std::string path;
+    for (int i = 0; i < 100; ++i)
+        path += "/key/6000";
+    const auto patch = Json::parse(R"([{"op":"replace","path":")" + path + R"(/key/0","value":"patched"}])");
+
+    std::optional<Json> copy;
+    const auto copy_ms = best_of_ms(3, [&]() {
+        copy = document;
+        ASSERT_TRUE(JsonPatch::apply(*copy, patch));
+    });
+    std::optional<Json> reparsed;
+    const auto reparse_ms = measure_ms([&]() {
+        reparsed = Json::parse(document_text);
+        ASSERT_TRUE(JsonPatch::apply(*reparsed, patch));
+    });
+    bool applied = false;
+    const auto patch_ms = best_of_ms(3, [&]() { applied = JsonPatch::apply(document, patch); });
+
+    const auto original = Json::parse(document_text);
+    auto diff = Json::create_array();
+    const auto diff_ms = measure_ms([&]() { diff = JsonPatch::diff(*reparsed, original); });
+
+    TEST_INFO << document_text.size() / 1024 << " KiB document, patch in place: " << patch_ms << " ms, on a copy: "
+              << copy_ms << " ms, parsed again: " << reparse_ms << " ms, diff: " << diff_ms << " ms" << std::endl;
+    ASSERT_TRUE(applied);
+    EXPECT_EQ(document, *copy);
+    EXPECT_EQ(document, *reparsed);
+    EXPECT_EQ(diff, Json::parse(R"([{"op":"replace","path":")" + path + R"(/key/0","value":1.5}])"));
+    EXPECT_LT(patch_ms * 10, copy_ms);
+}
@@ -0,0 +1,188 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonPatch.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace Core;
+
+namespace {
+/// \brief Apply \param patch to \param document, \returns the result or an invalid Json if it failed.
+Json patched(const std::string& document, const std::string& patch) {
+    auto json = Json::parse(document);
+    if (!JsonPatch::apply(json, Json::parse(patch)))
+        return Json::parse("");
+    return json;
+}
+}
+
+TEST(JsonPatchTest, Add) {
+    EXPECT_EQ(patched(R"({"foo":"bar"})", R"([{"op":"add","path":"/baz","value":"qux"}])"),
+              Json::parse(R"({"baz":"qux","foo":"bar"})"));
+    EXPECT_EQ(patched(R"({"foo":["bar","baz"]})", R"([{"op":"add","path":"/foo/1","value":"qux"}])"),
+              Json::parse(R"({"foo":["bar","qux","baz"]})"));
+    EXPECT_EQ(patched(R"({"foo":["bar"]})", R"([{"op":"add","path":"/foo/-","value":["abc","def"]}])"),
+              Json::parse(R"({"foo":["bar",["abc","def"]]})"));
+    EXPECT_EQ(patched(R"({"foo":"bar"})", R"([{"op":"add","path":"/child","value":{"grandchild":{}}}])"),
+              Json::parse(R"({"foo":"bar","child":{"grandchild":{}}})"));
+
+    // Adding an existing member replaces it
+    EXPECT_EQ(patched(R"({"foo":1})", R"([{"op":"add","path":"/foo","value":2}])"), Json::parse(R"({"foo":2})"));
+}
+
+TEST(JsonPatchTest, Remove) {
+    EXPECT_EQ(patched(R"({"baz":"qux","foo":"bar"})", R"([{"op":"remove","path":"/baz"}])"),
+              Json::parse(R"({"foo":"bar"})"));
+    EXPECT_EQ(patched(R"({"foo":["bar","qux","baz"]})", R"([{"op":"remove","path":"/foo/1"}])"),
+              Json::parse(R"({"foo":["bar","baz"]})"));
+}
+
+TEST(JsonPatchTest, Replace) {
+    EXPECT_EQ(patched(R"({"baz":"qux","foo":"bar"})", R"([{"op":"replace","path":"/baz","value":"boo"}])"),
+              Json::parse(R"({"baz":"boo","foo":"bar"})"));
+    EXPECT_EQ(patched(R"({"a":[1,2]})", R"([{"op":"replace","path":"","value":[3]}])"), Json::parse("[3]"));
+}
+
+TEST(JsonPatchTest, Move) {
+    EXPECT_EQ(patched(R"({"foo":{"bar":"baz","waldo":"fred"},"qux":{"corge":"grault"}})",
+                      R"([{"op":"move","from":"/foo/waldo","path":"/qux/thud"}])"),
+              Json::parse(R"({"foo":{"bar":"baz"},"qux":{"corge":"grault","thud":"fred"}})"));
+    EXPECT_EQ(patched(R"({"foo":["all","grass","cows","eat"]})", R"([{"op":"move","from":"/foo/1","path":"/foo/3"}])"),
+              Json::parse(R"({"foo":["all","cows","eat","grass"]})"));
+}
+
+TEST(JsonPatchTest, Copy) {
+    EXPECT_EQ(patched(R"({"a":{"b":[1]}})", R"([{"op":"copy","from":"/a","path":"/c"}])"),
+              Json::parse(R"({"a":{"b":[1]},"c":{"b":[1]}})"));
+}
+
+TEST(JsonPatchTest, Test) {
+    EXPECT_TRUE(patched(R"({"baz":"qux","foo":["a",2,"c"]})",
+                        R"([{"op":"test","path":"/baz","value":"qux"},{"op":"test","path":"/foo/1","value":2}])"));
+    EXPECT_FALSE(patched(R"({"baz":"qux"})", R"([{"op":"test","path":"/baz","value":"bar"}])"));
+
+    // Numbers are compared by value
+    EXPECT_TRUE(patched(R"({"a":1})", R"([{"op":"test","path":"/a","value":1.0}])"));
+    EXPECT_TRUE(patched(R"({"a":{"b":[1,2.5]}})", R"([{"op":"test","path":"","value":{"a":{"b":[1.0,2.5]}}}])"));
+}
+
+TEST(JsonPatchTest, EscapedTokens) {
+    EXPECT_EQ(patched(R"({"/":9,"~1":10})", R"([{"op":"test","path":"/~01","value":10},{"op":"remove","path":"/~1"}])"),
+              Json::parse(R"({"~1":10})"));
+    EXPECT_FALSE(patched(R"({"a":1})", R"([{"op":"remove","path":"/~2"}])"));
+}
+
+TEST(JsonPatchTest, Failures) {
+    EXPECT_FALSE(patched(R"({"foo":"bar"})", R"([{"op":"add","path":"/baz/bat","value":"qux"}])"));
+    EXPECT_FALSE(patched(R"({"foo":"bar"})", R"([{"op":"remove","path":"/baz"}])"));
+    EXPECT_FALSE(patched(R"({"foo":"bar"})", R"([{"op":"replace","path":"/baz","value":1}])"));
+    EXPECT_FALSE(patched(R"([1,2])", R"([{"op":"add","path":"/3","value":1}])"));
+    EXPECT_FALSE(patched(R"([1,2])", R"([{"op":"remove","path":"/01"}])"));
+    EXPECT_FALSE(patched(R"([1,2])", R"([{"op":"remove","path":"/-"}])"));
+    EXPECT_FALSE(patched(R"({"a":{"b":1}})", R"([{"op":"move","from":"/a","path":"/a/c"}])"));
+    EXPECT_FALSE(patched(R"({"a":1})", R"([{"op":"add","path":"a","value":1}])"));
+    EXPECT_FALSE(patched(R"({"a":1})", R"([{"op":"add","path":"/b"}])"));
+    EXPECT_FALSE(patched(R"({"a":1})", R"([{"op":"frobnicate","path":"/a"}])"));
+    EXPECT_FALSE(patched(R"({"a":1})", R"({"op":"remove","path":"/a"})"));
+    EXPECT_FALSE(patched(R"({"a":1})", R"([{"op":"replace","path":"","value":1}])"));
+}
+
+TEST(JsonPatchTest, FailedMoveKeepsTheValue) {
+    auto document = Json::parse(R"({"a":1,"b":2})");
+    EXPECT_FALSE(JsonPatch::apply(document, Json::parse(R"([{"op":"move","from":"/a","path":"/c/d"}])")));
+    EXPECT_EQ(document, Json::parse(R"({"a":1,"b":2})"));
+}
+
+TEST(JsonPatchTest, FailedPatchIsRolledBack) {
+    auto document = Json::parse(R"({"a":1})");
+    EXPECT_FALSE(JsonPatch::apply(document, Json::parse(R"([{"op":"add","path":"/b","value":2},{"op":"remove","path":"/c"}])")));
+    EXPECT_EQ(document, Json::parse(R"({"a":1})"));
+
+    const auto original = Json::parse(R"({"a":1,"b":[1,2,3],"c":{"d":"x","e":null},"f":true})");
+    // Operations of every kind that succeed, the patch fails on a test appended to them
+    const std::string operations = R"(
+        {"op":"add","path":"/b/-","value":4},
+        {"op":"add","path":"/b/0","value":0},
+        {"op":"add","path":"/a","value":"overwritten"},
+        {"op":"remove","path":"/b/2"},
+        {"op":"remove","path":"/f"},
+        {"op":"replace","path":"/c/d","value":"y"},
+        {"op":"move","from":"/c/e","path":"/b/1"},
+        {"op":"move","from":"/b/0","path":"/a"},
+        {"op":"copy","from":"/c","path":"/g"},
+        {"op":"test","path":"/a","value":0},
+        {"op":"add","path":"","value":[]})";
+    document = original;
+    ASSERT_TRUE(JsonPatch::apply(document, Json::parse("[" + operations + "]")));
+    EXPECT_EQ(document, Json::create_array());
+
+    document = original;
+    EXPECT_FALSE(JsonPatch::apply(document, Json::parse("[" + operations + R"(, {"op":"test","path":"/missing","value":0}])")));
+    EXPECT_EQ(document, original);
+}
+
+TEST(JsonPatchTest, Diff) {
+    const char* pairs[][2] = {
+            {R"({"a":1,"b":{"c":[1,2,3]},"d":"x"})", R"({"a":2,"b":{"c":[1,5]},"e":null})"},
+            {R"([1,2])", R"([1,2,{"a":[]},4])"},
+            {R"({"a":[1,{"b":2}]})", R"({"a":{"b":2}})"},
+            {R"({"a/b":{"~":1}})", R"({"a/b":{"~":2}})"},
+            {R"({"a":1})", R"([1])"},
+            {R"({})", R"({})"},
+    };
+    for (const auto& [from_text, to_text] : pairs) {
+        const auto from = Json::parse(from_text);
+        const auto to = Json::parse(to_text);
+        auto document = from;
+        EXPECT_TRUE(JsonPatch::apply(document, JsonPatch::diff(from, to))) << from_text;
+        EXPECT_EQ(document, to) << from_text << " -> " << to_text;
+    }
+
+    // Only the changed values are in the patch
+    EXPECT_EQ(JsonPatch::diff(Json::parse(R"({"a":{"b":[1,2]},"c":3})"), Json::parse(R"({"a":{"b":[1,4]},"c":3})")),
+              Json::parse(R"([{"op":"replace","path":"/a/b/1","value":4}])"));
+    EXPECT_EQ(JsonPatch::diff(Json::parse(R"({"a":1})"), Json::parse(R"({"a":1.0})")), Json::create_array());
+}
+
+TEST(JsonPatchTest, Merge) {
+    // Examples of RFC 7386, Appendix A
+    const char* cases[][3] = {
+            {R"({"a":"b"})", R"({"a":"c"})", R"({"a":"c"})"},
+            {R"({"a":"b"})", R"({"b":"c"})", R"({"a":"b","b":"c"})"},
+            {R"({"a":"b"})", R"({"a":null})", R"({})"},
+            {R"({"a":"b","b":"c"})", R"({"a":null})", R"({"b":"c"})"},
+            {R"({"a":["b"]})", R"({"a":"c"})", R"({"a":"c"})"},
+            {R"({"a":"c"})", R"({"a":["b"]})", R"({"a":["b"]})"},
+            {R"({"a":{"b":"c"}})", R"({"a":{"b":"d","c":null}})", R"({"a":{"b":"d"}})"},
+            {R"({"a":[{"b":"c"}]})", R"({"a":[1]})", R"({"a":[1]})"},
+            {R"(["a","b"])", R"(["c","d"])", R"(["c","d"])"},
+            {R"({"a":"b"})", R"(["c"])", R"(["c"])"},
+            {R"({"e":null})", R"({"a":1})", R"({"e":null,"a":1})"},
+            {R"([1,2])", R"({"a":"b","c":null})", R"({"a":"b"})"},
+            {R"({})", R"({"a":{"bb":{"ccc":null}}})", R"({"a":{"bb":{}}})"},
+    };
+    for (const auto& [target_text, patch_text, result_text] : cases) {
+        auto target = Json::parse(target_text);
+        JsonPatch::merge(target, Json::parse(patch_text));
+        EXPECT_EQ(target, Json::parse(result_text)) << target_text << " + " << patch_text;
+    }
+}
+
+TEST(JsonPatchTest, MergeDiff) {
+    const auto from = Json::parse(R"({"title":"Goodbye!","author":{"givenName":"John","familyName":"Doe"},
+                                      "tags":["example","sample"],"content":"This will be unchanged"})");
+    const auto to = Json::parse(R"({"title":"Hello!","author":{"givenName":"John"},"tags":["example"],
+                                    "content":"This will be unchanged","phoneNumber":"+01-123-456-7890"})");
+    const auto patch = JsonPatch::merge_diff(from, to);
+    EXPECT_EQ(patch, Json::parse(R"({"title":"Hello!","author":{"familyName":null},"tags":["example"],
+                                     "phoneNumber":"+01-123-456-7890"})"));
+
+    auto document = from;
+    JsonPatch::merge(document, patch);
+    EXPECT_EQ(document, to);
+}
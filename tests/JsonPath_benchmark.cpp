@@ -0,0 +1,41 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonPathBenchmark, precompiled_path_lookup)
+{
+    const Json json(nested_document(2, 3));
+    ASSERT_TRUE(json.valid());
+
+    constexpr int lookups = 200000;
+    constexpr int runs = 3;
+    const std::string text = "key[9].key[3]";
+    const JsonPath path(text);
+
+    double sum = 0;
+    const auto string_ms = best_of_ms(runs, [&]() {
+        for (int i = 0; i < lookups; ++i)
+            sum += *json.get<double>(text);
+    });
+    const auto compiled_ms = best_of_ms(runs, [&]() {
+        for (int i = 0; i < lookups; ++i)
+            sum += *json.get<double>(path);
+    });
+
+    TEST_INFO << lookups << " lookups by string: " << string_ms << " ms, precompiled: " << compiled_ms << " ms"
+              << std::endl;
+    EXPECT_EQ(sum, 2 * runs * lookups * 1.5);
+    EXPECT_LT(compiled_ms, string_ms);
+}
@@ -0,0 +1,129 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/CompactJson.hpp>
+#include <Json/Json.hpp>
+#include <Json/JsonPath.hpp>
+#include <Json/LazyJson.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+using namespace Core;
+
+namespace {
+const JsonPath compiled_path("people[1].name");
+static_assert(std::is_constructible_v<JsonPath, const std::string&>);
+static_assert(!std::is_constructible_v<JsonPath, std::string&&>);
+
+const std::string document = "{\"people\": [{\"name\": \"Ann\"}, {\"name\": \"Bob\", \"tags\": [[1, 2], [3]]}],"
+                             " \"a\": 1, \"x.y\": 2, \"odd[0]\": 3, \"odd[x]\": 4, \"odd\": [5]}";
+}
+
+TEST(JsonPath, parses_segments)
+{
+    const JsonPath path("a.bc[2][10].d");
+    ASSERT_EQ(path.size(), 5u);
+    EXPECT_EQ(path[0].raw_key(), "a");
+    EXPECT_EQ(path[1].raw_key(), "bc");
+    EXPECT_EQ(path[2].index(), 2u);
+    EXPECT_EQ(path[3].index(), 10u);
+    EXPECT_EQ(path[4].raw_key(), "d");
+
+    // A single character is a key too
+    ASSERT_EQ(JsonPath("a").size(), 1u);
+    EXPECT_TRUE(JsonPath("a")[0].matches("a"));
+    EXPECT_TRUE(JsonPath("").empty());
+    EXPECT_TRUE(JsonPath("..").empty());
+    EXPECT_TRUE(JsonPath("a\\.b")[0].matches("a.b"));
+    EXPECT_TRUE(compiled_path[0].matches("people"));
+    EXPECT_TRUE(compiled_path[1].is_index());
+}
+
+TEST(JsonPath, long_paths_are_not_limited)
+{
+    const auto depth = 4 * JsonPath::inline_segments;
+    std::string text = "a";
+    for (std::size_t i = 0; i < depth; ++i)
+        text += "[0]";
+    const JsonPath path(text);
+    ASSERT_EQ(path.size(), 4 * JsonPath::inline_segments + 1);
+    EXPECT_EQ(path[0].raw_key(), "a");
+    EXPECT_EQ(std::distance(path.begin(), path.end()), static_cast<std::ptrdiff_t>(path.size()));
+
+    const auto copy = path;
+    EXPECT_EQ(copy[copy.size() - 1].index(), 0u);
+
+    // The innermost array is empty
+    Json json("{\"a\": " + std::string(depth, '[') + std::string(depth, ']') + "}");
+    EXPECT_EQ(json.get<Json>(text.substr(0, text.size() - 3)), Json::create_array());
+    EXPECT_TRUE(json.find(path) == nullptr);
+
+    json.set(text, 1);
+    EXPECT_EQ(json.get<int>(path), 1);
+}
+
+TEST(JsonPath, brackets_without_index_belong_to_the_key)
+{
+    for (const auto* text : {"odd[x]", "odd[0]x", "odd[]", "odd[0][x]"}) {
+        const JsonPath path(text);
+        ASSERT_EQ(path.size(), 1u) << text;
+        EXPECT_TRUE(path[0].matches(text)) << text;
+    }
+
+    const JsonPath escaped("odd\\[0\\].x\\\\y");
+    ASSERT_EQ(escaped.size(), 2u);
+    EXPECT_TRUE(escaped[0].escaped());
+    EXPECT_EQ(escaped[0].key(), "odd[0]");
+    EXPECT_EQ(escaped[0].key_prefix(), "odd");
+    EXPECT_TRUE(escaped[1].matches("x\\y"));
+    EXPECT_FALSE(escaped[1].matches("x\\\\y"));
+}
+
+TEST(JsonPath, rejects_bad_paths)
+{
+    EXPECT_THROW(JsonPath("[99999999999]"), bad_json_path);
+    EXPECT_THROW(JsonPath("a[0"), bad_json_path);
+    EXPECT_THROW(JsonPath("["), bad_json_path);
+}
+
+TEST(JsonPath, looks_up_values)
+{
+    Json json(document);
+    ASSERT_TRUE(json);
+
+    EXPECT_EQ(json.get<std::string>(compiled_path), "Bob");
+    EXPECT_EQ(json.get<int>(JsonPath("a")), 1);
+    EXPECT_EQ(json.get<int>("a"), 1);
+    EXPECT_EQ(json.get<int>(JsonPath("people[1].tags[0][1]")), 2);
+    EXPECT_EQ(json.get<int>(JsonPath("x\\.y")), 2);
+    EXPECT_EQ(json.get<int>(JsonPath("odd\\[0\\]")), 3);
+    EXPECT_EQ(json.get<int>(JsonPath("odd[x]")), 4);
+    EXPECT_EQ(json.get<int>(JsonPath("odd[0]")), 5);
+    EXPECT_EQ(json.get(JsonPath("people[5]"), -1), -1);
+    EXPECT_FALSE(json.get(JsonPath("a.b")));
+    EXPECT_FALSE(json.get(JsonPath("")));
+
+    const JsonPath path("people[0].name");
+    json.set(path, std::string("Cid"));
+    EXPECT_EQ(json.get<std::string>(path), "Cid");
+    EXPECT_THROW(json.set(JsonPath(""), 1), bad_json_path);
+}
+
+TEST(JsonPath, looks_up_lazy_and_compact_documents)
+{
+    const LazyJson lazy(document);
+    const CompactJson compact(document);
+    ASSERT_TRUE(lazy && compact);
+
+    for (const auto* text : {"people[1].name", "x\\.y", "odd\\[0\\]", "odd[0]", "people[1].tags[0][1]"}) {
+        const JsonPath path(text);
+        EXPECT_EQ(lazy.get(path), Json(document).get(path)) << text;
+        EXPECT_EQ(compact.find_path(path)->value(), Json(document).get(path)) << text;
+    }
+    EXPECT_EQ(compact.get<std::string_view>(compiled_path), "Bob");
+}
@@ -0,0 +1,73 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonPattern.hpp>
+#include <Json/JsonSchema.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <string>
+
+using namespace Core;
+
+TEST(JsonPattern, matches_as_std_regex)
+{
+    const char* patterns[] = {"a", "^a", "a$", "^abc$", "a|bc|", "^(a|b)*c$", "(?:ab)+", "a{2}", "^a{2,}$", "^a{1,3}$",
+                              "^a{0,2}b", "x*?y", "[abc]", "[^abc]", "^[a-z0-9_-]+$", "[]]", "[]", "a}", "[\\]\\-]", "\\d+\\.\\d*",
+                              "\\w\\W", "\\s\\S", "[\\d\\s]", "\\bfoo\\b", "\\Boo\\B", "^.$", "\\x41\\u0042", "\\t|\\n",
+                              "(a*)*b", "(|a)+$", "^(\\([0-9]{3}\\))?[0-9]{3}-[0-9]{4}$", "^[a-zé]+$", "colou?r"};
+    const char* inputs[] = {"", "a", "aa", "aaa", "aaaa", "b", "abc", "xabcx", "bc", "ababc", "ababab", "xxy", "d", "]",
+                            "-", "12.5", "a b", "foo", "a foo b", "food", "boot", "\n", "\t", "AB", "aab", "(555)555-1234",
+                            "555-1234", "été", "color", "colour", "a_b-9", "a}"};
+
+    for (const auto* pattern : patterns) {
+        const auto compiled = JsonPattern::compile(pattern);
+        ASSERT_TRUE(compiled) << pattern;
+        const std::regex expected(pattern, std::regex::ECMAScript);
+        for (const std::string input : inputs)
+            EXPECT_EQ(compiled->search(input), std::regex_search(input, expected)) << pattern << " on " << input;
+    }
+}
+
+TEST(JsonPattern, long_inputs_do_not_recurse)
+{
+    const auto pattern = JsonPattern::compile("^(a|b)*c$");
+    ASSERT_TRUE(pattern);
+
+    std::string input(1 << 20, 'a');
+    EXPECT_FALSE(pattern->search(input));
+    input.back() = 'c';
+    EXPECT_TRUE(pattern->search(input));
+
+    // Without backtracking, nested quantifiers take linear time too
+    const auto nested = JsonPattern::compile("^(a*)*$");
+    ASSERT_TRUE(nested);
+    EXPECT_FALSE(nested->search(std::string(1 << 16, 'a') + "b"));
+
+    const JsonSchema schema(Json::parse(R"({"items":{"pattern":"^[a-c]*$"}})"));
+    auto document = Json::create_array();
+    document.push_back(std::string(1 << 20, 'b'));
+    EXPECT_TRUE(schema.validate(document));
+    EXPECT_TRUE(schema.validate_text("[\"" + std::string(1 << 20, 'b') + "\"]"));
+}
+
+TEST(JsonPattern, refuses_backtracking_patterns)
+{
+    // Lookarounds and backreferences would need std::regex, which recurses per character
+    for (const auto* pattern : {"^(?=.*\\d)\\w+$", "(?!a)", "(?<=a)b", "(a)\\1", "(?<x>a)\\k<x>", "a{1001}"})
+        EXPECT_FALSE(JsonPattern::compile(pattern)) << pattern;
+
+    // Schemas using them are invalid rather than failing on long inputs
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"pattern":"(a)\\1"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"json({"patternProperties":{"^(?=x)":{}}})json")).valid());
+}
+
+TEST(JsonPattern, rejects_malformed_patterns)
+{
+    for (const auto* pattern : {"(", "a)", "[a", "*", "a{2,1}", "(?<x", "\\"})
+        EXPECT_FALSE(JsonPattern::compile(pattern)) << pattern;
+}
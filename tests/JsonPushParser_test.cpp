@@ -0,0 +1,115 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonPushParser.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+const std::string document = "{\"name\": \"John\", \"age\": 25, \"height\": 1.85, \"tags\": [\"a\", \"b\"],"
+                             " \"address\": {\"city\": \"New York\", \"zip\": null}, \"active\": true}";
+
+/// \brief Feed \param text in chunks of \param chunk_size, collect the documents.
+std::vector<Json> parse_chunked(JsonPushParser& parser, std::string_view text, std::size_t chunk_size) {
+    std::vector<Json> documents;
+    for (std::size_t begin = 0; begin < text.size(); begin += chunk_size) {
+        auto rest = text.substr(begin, chunk_size);
+        while (!rest.empty()) {
+            const auto status = parser.feed(rest);
+            rest.remove_prefix(parser.consumed());
+            if (status == JsonPushParser::Status::Complete)
+                documents.push_back(*parser.take());
+            else if (status == JsonPushParser::Status::Error)
+                return documents;
+        }
+    }
+    return documents;
+}
+}
+
+TEST(JsonPushParser, builds_the_same_document)
+{
+    JsonPushParser parser;
+
+    EXPECT_EQ(parser.feed(document), JsonPushParser::Status::Complete);
+    EXPECT_EQ(parser.consumed(), document.size());
+
+    const auto parsed = parser.take();
+    ASSERT_TRUE(parsed);
+    EXPECT_TRUE(parsed->valid());
+    EXPECT_EQ(*parsed, Json(document));
+    EXPECT_FALSE(parser.take());
+}
+
+TEST(JsonPushParser, chunks_can_split_anywhere)
+{
+    const Json expected(document);
+    for (std::size_t chunk_size = 1; chunk_size <= document.size(); chunk_size += 3) {
+        JsonPushParser parser;
+        const auto documents = parse_chunked(parser, document, chunk_size);
+
+        ASSERT_EQ(documents.size(), 1u) << "chunk size " << chunk_size;
+        EXPECT_EQ(documents.front(), expected) << "chunk size " << chunk_size;
+        EXPECT_FALSE(parser.pending());
+    }
+}
+
+TEST(JsonPushParser, needs_more_until_complete)
+{
+    JsonPushParser parser;
+
+    EXPECT_EQ(parser.feed("  "), JsonPushParser::Status::NeedsMore);
+    EXPECT_FALSE(parser.pending());
+    EXPECT_EQ(parser.feed("[1, 2"), JsonPushParser::Status::NeedsMore);
+    EXPECT_TRUE(parser.pending());
+    EXPECT_FALSE(parser.take());
+    EXPECT_EQ(parser.feed("3]"), JsonPushParser::Status::Complete);
+    EXPECT_EQ(parser.offset(), 9u);
+
+    const auto parsed = parser.take();
+    ASSERT_TRUE(parsed);
+    EXPECT_EQ(parsed->size(), 2u);
+    EXPECT_EQ(parsed->at(1), 23);
+}
+
+TEST(JsonPushParser, parses_consecutive_documents)
+{
+    const std::string stream = "{\"id\": 1}\n[true]{\"id\": 2}  \n[]\n";
+    for (std::size_t chunk_size = 1; chunk_size <= stream.size(); ++chunk_size) {
+        JsonPushParser parser;
+        const auto documents = parse_chunked(parser, stream, chunk_size);
+
+        ASSERT_EQ(documents.size(), 4u) << "chunk size " << chunk_size;
+        EXPECT_EQ(documents[0], Json("{\"id\": 1}"));
+        EXPECT_EQ(documents[1], Json("[true]"));
+        EXPECT_EQ(documents[2], Json("{\"id\": 2}"));
+        EXPECT_EQ(documents[3], Json("[]"));
+        EXPECT_FALSE(parser.pending());
+    }
+}
+
+TEST(JsonPushParser, reports_errors)
+{
+    JsonPushParser parser;
+
+    EXPECT_EQ(parser.feed("[1]"), JsonPushParser::Status::Complete);
+    EXPECT_EQ(parser.feed(" [1, "), JsonPushParser::Status::NeedsMore);
+    EXPECT_EQ(parser.feed("x]"), JsonPushParser::Status::Error);
+    EXPECT_EQ(parser.consumed(), 0u);
+    EXPECT_EQ(parser.offset(), 8u);
+    EXPECT_EQ(parser.feed("[]"), JsonPushParser::Status::Error);
+
+    parser.reset();
+    EXPECT_EQ(parser.feed("[99999999999999999999999]"), JsonPushParser::Status::Error);
+
+    parser.reset();
+    EXPECT_EQ(parser.feed("[]"), JsonPushParser::Status::Complete);
+}
@@ -0,0 +1,31 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonSaxParser.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonSaxParserBenchmark, sax_parser_throughput)
+{
+    const auto document = nested_document(200, 2000);
+    const auto megabytes = static_cast<double>(document.size()) / (1024 * 1024);
+
+    const auto dom_ms = measure_ms([&]() { ASSERT_TRUE(Json(document).valid()); });
+
+    BaseJsonHandler handler;
+    std::istringstream stream(document);
+    const auto sax_ms = measure_ms([&]() { ASSERT_TRUE(JsonSaxParser::parse(stream, handler)); });
+
+    TEST_INFO << "DOM parse: " << megabytes / dom_ms * 1000 << " MB/s" << std::endl;
+    TEST_INFO << "SAX parse from a stream: " << megabytes / sax_ms * 1000 << " MB/s" << std::endl;
+}
@@ -0,0 +1,190 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonSaxParser.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+/// \brief Records the events as text.
+class RecordingHandler : public IJsonHandler {
+public:
+    std::string events;
+
+    bool on_object_begin() override {
+        events += "{ ";
+        return true;
+    }
+
+    bool on_object_end() override {
+        events += "} ";
+        return true;
+    }
+
+    bool on_array_begin() override {
+        events += "[ ";
+        return true;
+    }
+
+    bool on_array_end() override {
+        events += "] ";
+        return true;
+    }
+
+    bool on_key(std::string_view key) override {
+        events += "key:" + std::string(key) + " ";
+        return true;
+    }
+
+    bool on_string(std::string_view value) override {
+        events += "string:" + std::string(value) + " ";
+        return true;
+    }
+
+    bool on_number(std::string_view number) override {
+        events += "number:" + std::string(number) + " ";
+        return true;
+    }
+
+    bool on_bool(bool value) override {
+        events += value ? "true " : "false ";
+        return true;
+    }
+
+    bool on_null() override {
+        events += "null ";
+        return true;
+    }
+};
+
+/// \brief Collects the values of a single key, stops after \param limit values.
+class KeyCollector : public BaseJsonHandler {
+private:
+    std::string _key;
+    std::size_t _limit;
+    bool _matched = false;
+
+public:
+    std::vector<std::string> values;
+
+    KeyCollector(std::string key, std::size_t limit) : _key(std::move(key)), _limit(limit) {}
+
+    bool on_key(std::string_view key) override {
+        _matched = key == _key;
+        return true;
+    }
+
+    bool on_string(std::string_view value) override {
+        if (_matched)
+            values.emplace_back(value);
+        _matched = false;
+        return values.size() < _limit;
+    }
+};
+
+const std::string document = " {\"name\": \"John \\\"Jr\\\"\", \"caf\\u00e9\": \"\\ud83d\\ude00\\t\", \"age\": 25, \"scores\": [-1.5e3, 0, 12],"
+                             " \"flags\": [true, false, null], \"nested\": {\"empty\": {}, \"list\": []}}\n";
+
+// Escape sequences are decoded, also when a chunk ends inside them
+const std::string expected_events = "{ key:name string:John \"Jr\" key:caf\xc3\xa9 string:\xf0\x9f\x98\x80\t key:age number:25 key:scores [ "
+                                    "number:-1.5e3 number:0 number:12 ] key:flags [ true false null ] "
+                                    "key:nested { key:empty { } key:list [ ] } } ";
+
+bool parse_whole(const std::string& text) {
+    RecordingHandler handler;
+    JsonSaxParser parser(handler);
+    return parser.feed(text) && parser.finish();
+}
+}
+
+TEST(JsonSaxParser, reports_events)
+{
+    RecordingHandler handler;
+    JsonSaxParser parser(handler);
+
+    ASSERT_TRUE(parser.feed(document));
+    ASSERT_TRUE(parser.finish());
+    EXPECT_TRUE(parser.complete());
+    EXPECT_EQ(handler.events, expected_events);
+}
+
+TEST(JsonSaxParser, chunks_can_split_anywhere)
+{
+    for (std::size_t chunk_size = 1; chunk_size <= 8; ++chunk_size) {
+        RecordingHandler handler;
+        JsonSaxParser parser(handler);
+
+        for (std::size_t begin = 0; begin < document.size(); begin += chunk_size)
+            ASSERT_TRUE(parser.feed(std::string_view(document).substr(begin, chunk_size)));
+        ASSERT_TRUE(parser.finish());
+        EXPECT_EQ(handler.events, expected_events) << "chunk size " << chunk_size;
+    }
+}
+
+TEST(JsonSaxParser, reads_streams)
+{
+    RecordingHandler handler;
+    std::istringstream stream(document);
+
+    ASSERT_TRUE(JsonSaxParser::parse(stream, handler, 7));
+    EXPECT_EQ(handler.events, expected_events);
+}
+
+TEST(JsonSaxParser, accepts_what_json_accepts)
+{
+    const std::vector<std::string> documents = {
+        "{}", "[]", " [1, 2.5, -0, 1e5, 1E+5, 1e-5] ", "{\"a\": {\"b\": [\"\\u00e9\\n\"]}}",
+        "", "   ", "1", "\"string\"", "{", "[1,]", "[01]", "[1.]", "[.5]", "[1e]", "[-]", "[tru]", "[truex]",
+        "{\"a\" 1}", "{\"a\": 1,}", "{1: 2}", "[\"\\x\"]", "[\"\\u12g4\"]", "[\"tab\tinside\"]", "[1] [2]",
+        "[1}", "{\"a\": 1]",
+    };
+
+    for (const auto& text : documents)
+        EXPECT_EQ(parse_whole(text), Json(text).valid()) << text;
+}
+
+TEST(JsonSaxParser, reports_the_error_offset)
+{
+    RecordingHandler handler;
+    JsonSaxParser parser(handler);
+
+    EXPECT_TRUE(parser.feed("[1, 2, "));
+    EXPECT_FALSE(parser.feed("x]"));
+    EXPECT_TRUE(parser.failed());
+    EXPECT_EQ(parser.offset(), 7u);
+    EXPECT_FALSE(parser.feed("]"));
+
+    parser.reset();
+    EXPECT_TRUE(parser.feed("[1"));
+    EXPECT_FALSE(parser.finish());
+    EXPECT_EQ(parser.offset(), 2u);
+}
+
+TEST(JsonSaxParser, nesting_depth_is_limited)
+{
+    const auto depth = JsonSaxParser::max_depth + 1;
+    EXPECT_FALSE(parse_whole(std::string(depth, '[') + std::string(depth, ']')));
+    EXPECT_TRUE(parse_whole(std::string(depth - 1, '[') + std::string(depth - 1, ']')));
+}
+
+TEST(JsonSaxParser, handler_can_stop)
+{
+    const std::string text = "[{\"id\": \"a\"}, {\"id\": \"b\"}, {\"id\": \"c\"}]";
+    KeyCollector collector("id", 2);
+    JsonSaxParser parser(collector);
+
+    EXPECT_FALSE(parser.feed(text));
+    EXPECT_TRUE(parser.stopped());
+    EXPECT_FALSE(parser.failed());
+    EXPECT_EQ(collector.values, (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(text[parser.offset()], '"');
+}
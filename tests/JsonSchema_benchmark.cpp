@@ -0,0 +1,102 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonSchema.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonSchemaBenchmark, schema_validation_throughput)
+{
+    const int count = 50000;
+    std::string document = "[";
+    for (int i = 0; i < count; ++i) {
+        document += R"({"id": )" + std::to_string(i) + R"(, "customer": "customer-)" + std::to_string(i)
+                    + R"(", "email": "c)" + std::to_string(i) + R"(@example.com", "total": )" + std::to_string(i * 0.25)
+                    + R"(, "paid": true, "items": [{"sku": "A-1", "quantity": 2}, {"sku": "B-22", "quantity": 1}]})";
+        document += i + 1 < count ? ", " : "]";
+    }
+    const JsonSchema schema(Json::parse(R"({
+        "type": "array",
+        "items": {
+            "type": "object",
+            "required": ["id", "customer", "total", "items"],
+            "properties": {
+                "id": {"type": "integer", "minimum": 0},
+                "customer": {"type": "string", "minLength": 1, "maxLength": 64},
+                "email": {"type": "string", "maxLength": 254},
+                "total": {"type": "number", "minimum": 0},
+                "paid": {"type": "boolean"},
+                "items": {
+                    "type": "array",
+                    "minItems": 1,
+                    "items": {
+                        "type": "object",
+                        "required": ["sku", "quantity"],
+                        "properties": {
+                            "sku": {"type": "string", "maxLength": 16},
+                            "quantity": {"type": "integer", "minimum": 1}
+                        }
+                    }
+                }
+            }
+        }
+    })"));
+    ASSERT_TRUE(schema.valid());
+    const auto megabytes = static_cast<double>(document.size()) / (1024 * 1024);
+
+    // The checks as they are written by hand
+    bool hand_valid = false;
+    const auto hand_ms = measure_ms([&]() {
+        const auto json = Json::parse(document);
+        hand_valid = json.valid();
+        for (std::size_t i = 0; hand_valid && i < json.elements().size(); ++i) {
+            const auto prefix = "[" + std::to_string(i) + "].";
+            const auto customer = json.get<std::string>(prefix + "customer");
+            const auto items = json.get<Json>(prefix + "items");
+            hand_valid = json.get<int>(prefix + "id").value_or(-1) >= 0 && customer && !customer->empty()
+                         && customer->size() <= 64 && json.get<double>(prefix + "total", json.get<int>(prefix + "total", -1)) >= 0
+                         && items && !items->elements().empty();
+        }
+    });
+
+    bool dom_valid = false;
+    double parse_ms = 0;
+    const auto dom_ms = measure_ms([&]() {
+        std::optional<Json> json;
+        parse_ms = measure_ms([&]() { json = Json::parse(document); });
+        dom_valid = schema.validate(*json);
+    });
+
+    bool text_valid = false;
+    const auto text_ms = best_of_ms(3, [&]() { text_valid = schema.validate_text(document); });
+
+    // An error in the first record stops the validation
+    auto invalid = document;
+    invalid.replace(invalid.find("\"quantity\": 2"), 13, "\"quantity\": 0");
+    JsonSchema::Error error;
+    bool invalid_valid = true;
+    const auto early_exit_ms = best_of_ms(3, [&]() { invalid_valid = schema.validate_text(invalid, &error); });
+
+    TEST_INFO << megabytes << " MB, hand written checks: " << hand_ms << " ms, parse and validate: " << dom_ms
+              << " ms (" << dom_ms - parse_ms << " ms validating), validate while parsing: " << text_ms << " ms ("
+              << megabytes / text_ms * 1000 << " MB/s)" << std::endl;
+    TEST_INFO << "First record invalid: " << early_exit_ms << " ms" << std::endl;
+    EXPECT_TRUE(hand_valid);
+    EXPECT_TRUE(dom_valid);
+    EXPECT_TRUE(text_valid);
+    EXPECT_FALSE(invalid_valid);
+    EXPECT_EQ(error.path, "/0/items/0/quantity");
+    EXPECT_LT(text_ms, parse_ms);
+    EXPECT_LT(early_exit_ms * 100, text_ms);
+}
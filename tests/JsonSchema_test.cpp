@@ -0,0 +1,210 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonSchema.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace Core;
+
+namespace {
+/// \brief Validate \param document against \param schema both as a Json and as text, the results must agree.
+bool accepts(const std::string& schema, const std::string& document) {
+    const JsonSchema compiled(Json::parse(schema));
+    EXPECT_TRUE(compiled.valid()) << schema;
+
+    const auto dom = compiled.validate(Json::parse(document));
+    const auto text = compiled.validate_text(document);
+    EXPECT_EQ(dom, text) << schema << " with " << document;
+    return dom && text;
+}
+
+/// \brief The error of validating \param document as text, it must be the same as for the Json.
+JsonSchema::Error error_of(const std::string& schema, const std::string& document) {
+    const JsonSchema compiled(Json::parse(schema));
+    JsonSchema::Error dom_error;
+    JsonSchema::Error text_error;
+    EXPECT_FALSE(compiled.validate(Json::parse(document), &dom_error));
+    EXPECT_FALSE(compiled.validate_text(document, &text_error));
+    EXPECT_EQ(dom_error.path, text_error.path);
+    EXPECT_EQ(dom_error.message, text_error.message);
+    return text_error;
+}
+}
+
+TEST(JsonSchemaTest, Types) {
+    EXPECT_TRUE(accepts(R"({"type":"object"})", "{}"));
+    EXPECT_FALSE(accepts(R"({"type":"object"})", "[]"));
+    EXPECT_TRUE(accepts(R"({"items":{"type":"integer"}})", "[1, 2.0, -3, 1e2]"));
+    EXPECT_FALSE(accepts(R"({"items":{"type":"integer"}})", "[1.5]"));
+    EXPECT_TRUE(accepts(R"({"items":{"type":"number"}})", "[1, 1.5]"));
+    EXPECT_TRUE(accepts(R"({"items":{"type":["string","null"]}})", R"(["a", null])"));
+    EXPECT_FALSE(accepts(R"({"items":{"type":["string","null"]}})", R"([true])"));
+    EXPECT_TRUE(accepts(R"({"items":{"type":"boolean"}})", "[true, false]"));
+    EXPECT_FALSE(accepts(R"({"items":{"type":"boolean"}})", "[0]"));
+}
+
+TEST(JsonSchemaTest, BooleanSchemas) {
+    EXPECT_TRUE(accepts(R"({"items":true})", "[1, {}]"));
+    EXPECT_FALSE(accepts(R"({"items":false})", "[1]"));
+    EXPECT_TRUE(accepts(R"({"items":false})", "[]"));
+}
+
+TEST(JsonSchemaTest, Numbers) {
+    const auto schema = R"({"items":{"minimum":1,"exclusiveMaximum":10,"multipleOf":0.5}})";
+    EXPECT_TRUE(accepts(schema, "[1, 9.5, 2]"));
+    EXPECT_FALSE(accepts(schema, "[0.5]"));
+    EXPECT_FALSE(accepts(schema, "[10]"));
+    EXPECT_FALSE(accepts(schema, "[1.25]"));
+    EXPECT_TRUE(accepts(R"({"items":{"multipleOf":0.0001}})", "[0.0075]"));
+    EXPECT_FALSE(accepts(R"({"items":{"maximum":3,"exclusiveMinimum":0}})", "[0]"));
+
+    // Bounds only apply to numbers
+    EXPECT_TRUE(accepts(R"({"items":{"minimum":1}})", R"(["a", null])"));
+}
+
+TEST(JsonSchemaTest, Strings) {
+    const auto schema = R"({"items":{"minLength":2,"maxLength":3,"pattern":"^[a-zé]+$"}})";
+    EXPECT_TRUE(accepts(schema, R"(["ab", "abc", "éé"])"));
+    EXPECT_FALSE(accepts(schema, R"(["a"])"));
+    EXPECT_FALSE(accepts(schema, R"(["abcd"])"));
+    EXPECT_FALSE(accepts(schema, R"(["A1"])"));
+    EXPECT_TRUE(accepts(R"({"items":{"pattern":"b"}})", R"(["abc"])"));
+    EXPECT_TRUE(accepts(R"({"items":{"maxLength":1}})", R"(["\n"])"));
+}
+
+TEST(JsonSchemaTest, Arrays) {
+    EXPECT_TRUE(accepts(R"({"minItems":1,"maxItems":2})", "[1, 2]"));
+    EXPECT_FALSE(accepts(R"({"minItems":1,"maxItems":2})", "[]"));
+    EXPECT_FALSE(accepts(R"({"minItems":1,"maxItems":2})", "[1, 2, 3]"));
+
+    const auto tuple = R"({"items":[{"type":"string"},{"type":"integer"}],"additionalItems":false})";
+    EXPECT_TRUE(accepts(tuple, R"(["a", 1])"));
+    EXPECT_TRUE(accepts(tuple, R"(["a"])"));
+    EXPECT_FALSE(accepts(tuple, R"([1, 1])"));
+    EXPECT_FALSE(accepts(tuple, R"(["a", 1, 2])"));
+
+    EXPECT_TRUE(accepts(R"({"uniqueItems":true})", R"([1, "1", {"a":1}, {"a":2}])"));
+    EXPECT_FALSE(accepts(R"({"uniqueItems":true})", R"([1, 1.0])"));
+    EXPECT_FALSE(accepts(R"({"uniqueItems":true})", R"([{"a":[1]}, {"a":[1]}])"));
+
+    EXPECT_TRUE(accepts(R"({"contains":{"const":5}})", "[1, 5]"));
+    EXPECT_FALSE(accepts(R"({"contains":{"const":5}})", "[1, 2]"));
+}
+
+TEST(JsonSchemaTest, Objects) {
+    const auto schema = R"({"properties":{"name":{"type":"string"},"age":{"type":"integer","minimum":0}},
+                            "required":["name"],"additionalProperties":false})";
+    EXPECT_TRUE(accepts(schema, R"({"name":"a","age":3})"));
+    EXPECT_TRUE(accepts(schema, R"({"name":"a"})"));
+    EXPECT_FALSE(accepts(schema, R"({"age":3})"));
+    EXPECT_FALSE(accepts(schema, R"({"name":"a","age":-1})"));
+    EXPECT_FALSE(accepts(schema, R"({"name":"a","other":1})"));
+    EXPECT_TRUE(accepts(schema, R"({"name":"a"})"));
+
+    EXPECT_TRUE(accepts(R"({"minProperties":1,"maxProperties":1})", R"({"a":1})"));
+    EXPECT_FALSE(accepts(R"({"minProperties":1,"maxProperties":1})", R"({"a":1,"b":2})"));
+
+    const auto patterns = R"({"patternProperties":{"^x-":{"type":"string"}},"additionalProperties":{"type":"number"}})";
+    EXPECT_TRUE(accepts(patterns, R"({"x-a":"s","b":1})"));
+    EXPECT_FALSE(accepts(patterns, R"({"x-a":1})"));
+    EXPECT_FALSE(accepts(patterns, R"({"b":"s"})"));
+
+    EXPECT_TRUE(accepts(R"({"propertyNames":{"maxLength":2}})", R"({"ab":1})"));
+    EXPECT_FALSE(accepts(R"({"propertyNames":{"maxLength":2}})", R"({"abc":1})"));
+
+    const auto dependencies = R"({"dependencies":{"card":["billing"],"vip":{"required":["level"]}}})";
+    EXPECT_TRUE(accepts(dependencies, R"({"card":1,"billing":2})"));
+    EXPECT_FALSE(accepts(dependencies, R"({"card":1})"));
+    EXPECT_FALSE(accepts(dependencies, R"({"vip":true})"));
+    EXPECT_TRUE(accepts(dependencies, R"({"vip":true,"level":1})"));
+}
+
+TEST(JsonSchemaTest, EnumAndConst) {
+    EXPECT_TRUE(accepts(R"({"items":{"enum":[1,"a",null,[1]]}})", R"([1.0, "a", null, [1]])"));
+    EXPECT_FALSE(accepts(R"({"items":{"enum":[1,"a"]}})", R"(["b"])"));
+    EXPECT_TRUE(accepts(R"({"const":{"a":[1,2]}})", R"({"a":[1,2]})"));
+    EXPECT_FALSE(accepts(R"({"const":{"a":[1,2]}})", R"({"a":[2,1]})"));
+    EXPECT_FALSE(accepts(R"({"items":{"enum":[1,2],"const":2}})", "[1]"));
+}
+
+TEST(JsonSchemaTest, Combinators) {
+    EXPECT_TRUE(accepts(R"({"items":{"allOf":[{"minimum":1},{"maximum":2}]}})", "[1.5]"));
+    EXPECT_FALSE(accepts(R"({"items":{"allOf":[{"minimum":1},{"maximum":2}]}})", "[3]"));
+    EXPECT_TRUE(accepts(R"({"items":{"anyOf":[{"type":"string"},{"minimum":5}]}})", R"(["a", 6])"));
+    EXPECT_FALSE(accepts(R"({"items":{"anyOf":[{"type":"string"},{"minimum":5}]}})", "[4]"));
+    EXPECT_TRUE(accepts(R"({"items":{"oneOf":[{"type":"integer"},{"minimum":5}]}})", "[1, 5.5]"));
+    EXPECT_FALSE(accepts(R"({"items":{"oneOf":[{"type":"integer"},{"minimum":5}]}})", "[6]"));
+    EXPECT_TRUE(accepts(R"({"items":{"not":{"type":"string"}}})", "[1]"));
+    EXPECT_FALSE(accepts(R"({"items":{"not":{"type":"string"}}})", R"(["a"])"));
+
+    const auto conditional = R"({"items":{"if":{"type":"integer"},"then":{"minimum":0},"else":{"type":"string"}}})";
+    EXPECT_TRUE(accepts(conditional, R"([1, "a"])"));
+    EXPECT_FALSE(accepts(conditional, "[-1]"));
+    EXPECT_FALSE(accepts(conditional, "[1.5]"));
+}
+
+TEST(JsonSchemaTest, References) {
+    const auto tree = R"({"definitions":{"node":{"type":"object","properties":{"value":{"type":"integer"},
+                          "children":{"type":"array","items":{"$ref":"#/definitions/node"}}}}},
+                          "$ref":"#/definitions/node"})";
+    EXPECT_TRUE(accepts(tree, R"({"value":1,"children":[{"value":2,"children":[]},{"value":3}]})"));
+    EXPECT_FALSE(accepts(tree, R"({"value":1,"children":[{"value":2,"children":[{"value":"x"}]}]})"));
+
+    const auto root = R"({"properties":{"next":{"$ref":"#"},"id":{"type":"string"}}})";
+    EXPECT_TRUE(accepts(root, R"({"id":"a","next":{"id":"b","next":{}}})"));
+    EXPECT_FALSE(accepts(root, R"({"id":"a","next":{"id":2}})"));
+    EXPECT_TRUE(accepts(R"({"properties":{"a/b":{"type":"string"},"c":{"$ref":"#/properties/a~1b"}}})", R"({"c":"x"})"));
+}
+
+TEST(JsonSchemaTest, InvalidSchemas) {
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"type":"text"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"minimum":"1"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"pattern":"("})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"$ref":"other.json#"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"$ref":"#/definitions/missing"})")).valid());
+    EXPECT_TRUE(accepts(R"({"definitions":{"list":[{"type":"string"}]},"items":{"$ref":"#/definitions/list/0"}})", R"(["x"])"));
+    EXPECT_FALSE(accepts(R"({"definitions":{"list":[{"type":"string"}]},"items":{"$ref":"#/definitions/list/0"}})", R"([1])"));
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"definitions":{"list":[{}]},"$ref":"#/definitions/list/00"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"definitions":{},"$ref":"#definitions"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"definitions":{"a":{"$ref":"#/definitions/a"}},"$ref":"#/definitions/a"})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"allOf":[]})")).valid());
+    EXPECT_FALSE(JsonSchema(Json::parse("[]")).valid());
+
+    const JsonSchema invalid(Json::parse(R"({"type":"text"})"));
+    EXPECT_FALSE(invalid.validate(Json::parse("{}")));
+    EXPECT_FALSE(invalid.validate_text("{}"));
+}
+
+TEST(JsonSchemaTest, InvalidText) {
+    const JsonSchema schema(Json::parse(R"({"items":{"type":"integer"}})"));
+    EXPECT_TRUE(schema.validate_text(" [1, 2] "));
+    EXPECT_FALSE(schema.validate_text("[1, 2"));
+    EXPECT_FALSE(schema.validate_text("[1, 2] x"));
+    EXPECT_FALSE(schema.validate_text("1"));
+
+    JsonSchema::Error error;
+    EXPECT_FALSE(schema.validate_text("[1, 2,]", &error));
+    EXPECT_EQ(error.message, "invalid JSON at offset 6");
+
+    // Subtrees that are built for their checks are validated as JSON too
+    EXPECT_FALSE(JsonSchema(Json::parse(R"({"items":{"uniqueItems":true}})")).validate_text("[[1, 2}]"));
+}
+
+TEST(JsonSchemaTest, ErrorPath) {
+    const auto schema = R"({"properties":{"orders":{"items":{"properties":{"total":{"minimum":0}},"required":["id"]}}}})";
+    auto error = error_of(schema, R"({"orders":[{"id":1,"total":1},{"id":2,"total":-1}]})");
+    EXPECT_EQ(error.path, "/orders/1/total");
+    EXPECT_EQ(error.message, "value is less than the minimum");
+
+    error = error_of(schema, R"({"orders":[{"total":1}]})");
+    EXPECT_EQ(error.path, "/orders/0");
+    EXPECT_EQ(error.message, "required member id is missing");
+
+    error = error_of(R"({"additionalProperties":{"type":"string"}})", R"({"a/~b":1})");
+    EXPECT_EQ(error.path, "/a~1~0b");
+}
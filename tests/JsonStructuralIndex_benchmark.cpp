@@ -0,0 +1,40 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonStructuralIndex.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonStructuralIndexBenchmark, structural_index_throughput)
+{
+    const auto document = nested_document(200, 2000);
+    const auto megabytes = static_cast<double>(document.size()) / (1024 * 1024);
+
+    std::optional<Json> scalar;
+    const auto scalar_ms = measure_ms([&]() { scalar = Json::parse(document); });
+    TEST_INFO << megabytes << " MB, scalar parse: " << megabytes / scalar_ms * 1000 << " MB/s" << std::endl;
+
+    for (auto implementation : {JsonStructuralIndex::Implementation::Scalar,
+                                JsonStructuralIndex::Implementation::SSE42,
+                                JsonStructuralIndex::Implementation::AVX2}) {
+        std::optional<JsonStructuralIndex> index;
+        const auto index_ms = measure_ms([&]() { index.emplace(document, implementation); });
+        std::optional<Json> parsed;
+        const auto walk_ms = measure_ms([&]() { parsed = Json(*index); });
+
+        TEST_INFO << "Implementation " << static_cast<int>(index->implementation()) << ", index: "
+                  << megabytes / index_ms * 1000 << " MB/s, walk: " << megabytes / walk_ms * 1000
+                  << " MB/s, two-stage parse: " << megabytes / (index_ms + walk_ms) * 1000 << " MB/s" << std::endl;
+        EXPECT_EQ(*parsed, *scalar);
+    }
+}
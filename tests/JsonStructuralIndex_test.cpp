@@ -0,0 +1,139 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonStructuralIndex.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+const std::vector<JsonStructuralIndex::Implementation> implementations = {
+    JsonStructuralIndex::Implementation::Scalar,
+    JsonStructuralIndex::Implementation::SSE42,
+    JsonStructuralIndex::Implementation::AVX2
+};
+
+/// \brief Documents exercising the block boundaries, escapes and whitespace handling.
+std::vector<std::string> documents() {
+    std::vector<std::string> result = {
+        "{}",
+        "  [ ]  ",
+        "{\"a\": 1, \"b\": [true, false, null], \"c\": {\"d\": -1.5e3}}",
+        "[\"escaped \\\" quote\", \"backslash \\\\\", \"\\\\\\\"\", \"\\u00e9\\n\"]",
+        "[1,2,3,\"x\",{\"y\":\"z\"}]",
+        "\t[\r\n1 ,\n 2 ] \n",
+        // invalid documents
+        "{\"a\": 1",
+        "[1 2]",
+        "[\"unterminated]",
+        "[\"control \n character\"]",
+        "[\"bad \\x escape\"]",
+        "[tru]",
+        "{\"a\" 1}",
+        "[1] x",
+        // scalars end at the next token of the index
+        "[01]",
+        "[1x]",
+        "[truex]",
+        "[-]",
+        "[1.5e]",
+        "[\"a\"1]",
+        "{\"a\":1,\"a\":[2]}",
+        "[99999999999999999999]",
+        "[1e999]",
+        "[nul]",
+        "{\"a\":}",
+        "[1,]",
+        "",
+        "   ",
+        std::string(1025, '[') + std::string(1025, ']'),
+        std::string(1024, '[') + std::string(1024, ']'),
+    };
+
+    // strings, numbers and backslash runs crossing the 64 byte blocks
+    for (std::size_t padding = 50; padding < 70; ++padding) {
+        result.push_back("[\"" + std::string(padding, 'a') + "\\\\\\\"" + std::string(padding, 'b') + "\", "
+                         + std::string(padding, ' ') + "123456789, \"" + std::string(padding, '\\')
+                         + "\"]");
+        result.push_back("{" + std::string(padding, ' ') + "\"key\":\"" + std::string(padding, 'c') + "\"}");
+    }
+    return result;
+}
+}
+
+TEST(JsonStructuralIndex, matches_scalar_parser)
+{
+    for (const auto& document : documents()) {
+        const Json expected(document);
+        for (auto implementation : implementations) {
+            const JsonStructuralIndex index(document, implementation);
+            const Json parsed(index);
+            ASSERT_EQ(parsed.valid(), expected.valid()) << document;
+            if (expected.valid()) {
+                ASSERT_EQ(parsed, expected) << document;
+            }
+        }
+    }
+}
+
+TEST(JsonStructuralIndex, implementations_agree)
+{
+    for (const auto& document : documents()) {
+        const JsonStructuralIndex scalar(document, JsonStructuralIndex::Implementation::Scalar);
+        for (auto implementation : implementations) {
+            const JsonStructuralIndex index(document, implementation);
+            ASSERT_EQ(index.valid(), scalar.valid()) << document;
+            ASSERT_EQ(index.structurals(), scalar.structurals()) << document;
+        }
+    }
+}
+
+TEST(JsonStructuralIndex, indexes_structurals_outside_of_strings)
+{
+    const std::string document = "{\"a,b\": [1, true]}";
+    const JsonStructuralIndex index(document);
+
+    ASSERT_TRUE(index.valid());
+    // {  "  :  [  1  ,  t  ]  }
+    const std::vector<std::uint32_t> expected = {0, 1, 6, 8, 9, 10, 12, 16, 17};
+    EXPECT_EQ(index.structurals(), expected);
+}
+
+TEST(JsonStructuralIndex, unterminated_string_is_invalid)
+{
+    const std::string document = "[\"abc";
+    const JsonStructuralIndex index(document);
+
+    EXPECT_FALSE(index.valid());
+    EXPECT_FALSE(Json(index).valid());
+}
+
+TEST(JsonStructuralIndex, uses_best_implementation_by_default)
+{
+    const JsonStructuralIndex index("[]");
+    EXPECT_EQ(index.implementation(), JsonStructuralIndex::best_implementation());
+    EXPECT_TRUE(Json(index).valid());
+}
+
+TEST(JsonStructuralIndex, walks_large_documents)
+{
+    std::string document = "{\"items\": [";
+    for (int i = 0; i < 2000; ++i) {
+        document += "{\"id\": " + std::to_string(i) + ", \"ratio\": " + std::to_string(i) + ".25e-1,"
+                    " \"name\": \"item \\\"" + std::to_string(i) + "\\\" \\u00e9\", \"tags\": [\"a\", \"b\\\\\"],"
+                    " \"flag\": " + (i % 2 ? "true" : "false") + ", \"none\": null},\n  ";
+    }
+    document += "{}]}";
+
+    const Json expected(document);
+    ASSERT_TRUE(expected);
+    for (auto implementation : implementations)
+        EXPECT_EQ(Json(JsonStructuralIndex(document, implementation)), expected);
+}
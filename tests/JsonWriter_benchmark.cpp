@@ -0,0 +1,37 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonWriter.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonWriterBenchmark, serializer_throughput)
+{
+    const Json json(nested_document(100, 1000));
+    ASSERT_TRUE(json.valid());
+
+    JsonWriter minified;
+    JsonWriter pretty(JsonWriter::Style::Pretty);
+    const auto minified_ms = measure_ms([&]() { minified.write(json); });
+    const auto pretty_ms = measure_ms([&]() { pretty.write(json); });
+
+    std::ostringstream stream;
+    const auto stream_ms = measure_ms([&]() { stream << json; });
+
+    const auto megabytes = static_cast<double>(pretty.buffer().size()) / 1e6;
+    TEST_INFO << "Minified: " << minified.buffer().size() << " bytes in " << minified_ms << " ms" << std::endl;
+    TEST_INFO << "Pretty: " << megabytes / pretty_ms * 1000 << " MB/s, through operator<<: "
+              << megabytes / stream_ms * 1000 << " MB/s" << std::endl;
+    EXPECT_LT(minified.buffer().size(), pretty.buffer().size());
+    EXPECT_EQ(stream.str(), pretty.buffer());
+}
@@ -0,0 +1,99 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/JsonWriter.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace Core;
+
+TEST(JsonWriter, writes_minified)
+{
+    Json json("{\"b\": [1, 2.5, \"x\", null, true, false, {}, []], \"a\": {\"c\": -3}}");
+    ASSERT_TRUE(json);
+    EXPECT_EQ(JsonWriter::to_string(json), "{\"b\":[1,2.5,\"x\",null,true,false,{},[]],\"a\":{\"c\":-3}}");
+    EXPECT_EQ(JsonWriter::to_string(Json::create_array()), "[]");
+}
+
+TEST(JsonWriter, writes_pretty)
+{
+    Json json("{\"a\": [1, {}], \"b\": {\"c\": null}}");
+    ASSERT_TRUE(json);
+    EXPECT_EQ(JsonWriter::to_string(json, JsonWriter::Style::Pretty),
+              "{\n\t\"a\": [\n\t\t1,\n\t\t{}\n\t],\n\t\"b\": {\n\t\t\"c\": null\n\t}\n}");
+
+    JsonWriter writer(JsonWriter::Style::Pretty, "  ");
+    writer.write(Json("[[]]"));
+    EXPECT_EQ(writer.buffer(), "[\n  []\n]");
+
+    std::ostringstream stream;
+    stream << json;
+    EXPECT_EQ(stream.str(), JsonWriter::to_string(json, JsonWriter::Style::Pretty));
+}
+
+TEST(JsonWriter, escapes_strings)
+{
+    JsonWriter writer;
+    writer.write_string("quote \" backslash \\ tab \t line\n\x01 caf\xc3\xa9");
+    EXPECT_EQ(writer.buffer(), "\"quote \\\" backslash \\\\ tab \\t line\\n\\u0001 caf\xc3\xa9\"");
+
+    auto json = Json::create_object();
+    json.set("text", std::string("a\"b\\c\r\b\f/\x1f"));
+    Json reparsed(JsonWriter::to_string(json));
+    ASSERT_TRUE(reparsed);
+    EXPECT_EQ(reparsed, json);
+}
+
+TEST(JsonWriter, unescapes_when_parsing)
+{
+    Json json("[\"\\u00e9\\n\\/\", \"\\ud83d\\ude00\", \"\\\"\"]");
+    ASSERT_TRUE(json);
+    EXPECT_EQ(json[0], std::string("\xc3\xa9\n/"));
+    EXPECT_EQ(json[1], std::string("\xf0\x9f\x98\x80"));
+    EXPECT_EQ(json[2], std::string("\""));
+}
+
+TEST(JsonWriter, numbers_round_trip)
+{
+    auto json = Json::create_array();
+    json.push_back(0.1);
+    json.push_back(1.0);
+    json.push_back(-2.5e-300);
+    json.push_back(1e21);
+    json.push_back(std::numeric_limits<long>::min());
+    json.push_back(std::numeric_limits<int>::max());
+
+    const auto text = JsonWriter::to_string(json);
+    EXPECT_EQ(text, "[0.1,1.0,-2.5e-300,1e+21," + std::to_string(std::numeric_limits<long>::min()) + ",2147483647]");
+
+    Json reparsed(text);
+    ASSERT_TRUE(reparsed);
+    EXPECT_EQ(reparsed, json);
+
+    JsonWriter writer;
+    writer.write_number(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(writer.buffer(), "null");
+}
+
+TEST(JsonWriter, copies_to_output_iterator)
+{
+    JsonWriter writer;
+    writer.write(Json("{\"a\": 1}")).write(Json("[2]"));
+
+    std::string copy;
+    writer.copy_to(std::back_inserter(copy));
+    EXPECT_EQ(copy, "{\"a\":1}[2]");
+
+    const auto taken = writer.take();
+    EXPECT_EQ(taken, copy);
+    writer.clear();
+    EXPECT_TRUE(writer.buffer().empty());
+}
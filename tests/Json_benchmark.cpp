@@ -0,0 +1,132 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(JsonBenchmark, parse_time_is_linear_in_nesting)
+{
+    const auto shallow = nested_document(100, 200);
+    const auto deep = nested_document(400, 200);
+
+    bool valid = true;
+    const auto shallow_ms = best_of_ms(5, [&]() { valid = valid && Json(shallow).valid(); });
+    const auto deep_ms = best_of_ms(5, [&]() { valid = valid && Json(deep).valid(); });
+    ASSERT_TRUE(valid);
+
+    TEST_INFO << "Depth 100 (" << shallow.size() << " bytes): " << shallow_ms << " ms" << std::endl;
+    TEST_INFO << "Depth 400 (" << deep.size() << " bytes): " << deep_ms << " ms" << std::endl;
+    // 4 times the input, a quadratic parser would take 16 times as long
+    EXPECT_LT(deep_ms, shallow_ms * 10);
+}
+
+TEST(JsonBenchmark, zero_copy_subtree_access)
+{
+    const Json json(nested_document(100, 200));
+    ASSERT_TRUE(json.valid());
+
+    std::size_t copy_size = 0;
+    std::size_t view_size = 0;
+    const auto copy_ms = best_of_ms(3, [&]() { copy_size = json.get<Json>("key[600]")->size(); });
+    const auto view_ms = best_of_ms(3, [&]() { view_size = json.get_if<Json>("key[600]")->size(); });
+
+    std::size_t strings = 0;
+    const auto iterate_ms = measure_ms([&]() {
+        for (const auto* level = &json; level;) {
+            const auto* next = static_cast<const Json*>(nullptr);
+            for (const auto& element : std::get<Json>(level->members().begin()->second).elements()) {
+                strings += element.is<std::string>();
+                if (const auto* child = std::get_if<Json>(&element.to_std_variant()))
+                    next = child;
+            }
+            level = next;
+        }
+    });
+
+    TEST_INFO << "Subtree copy: " << copy_ms << " ms, in place: " << view_ms << " ms" << std::endl;
+    TEST_INFO << "Iterating " << strings << " strings in place: " << iterate_ms << " ms" << std::endl;
+    EXPECT_EQ(copy_size, 1u);
+    EXPECT_EQ(view_size, 1u);
+    EXPECT_EQ(strings, 100u * 200u);
+    EXPECT_LT(view_ms, copy_ms);
+}
+
+TEST(JsonBenchmark, number_parsing_throughput)
+{
+    std::string document = "[";
+    for (int i = 0; i < 200000; ++i)
+        document += std::to_string(i * 7919) + ", " + std::to_string(i * 3000000007LL) + ", " + std::to_string(i) + ".25e-3, ";
+    document += "0]";
+
+    std::optional<Json> json;
+    const auto parse_ms = measure_ms([&]() { json.emplace(document); });
+    ASSERT_TRUE(json->valid());
+    EXPECT_EQ(json->size(), 600001u);
+
+    TEST_INFO << json->size() << " numbers in " << parse_ms << " ms, "
+              << static_cast<double>(document.size()) / 1e3 / parse_ms << " MB/s" << std::endl;
+}
+
+TEST(JsonBenchmark, validation_only_throughput)
+{
+    std::string strings = "[";
+    for (int i = 0; i < 100000; ++i)
+        strings += R"({"name": "customer number )" + std::to_string(i) + R"(", "note": "a longer text that is typical of descriptions and comments, \"quoted\""}, )";
+    strings += "null]";
+    const auto nested = nested_document(200, 2000);
+
+    for (const auto* document : {&std::as_const(strings), &nested}) {
+        const auto megabytes = static_cast<double>(document->size()) / (1024 * 1024);
+
+        // Reading every byte once is the bound to compare to
+        std::size_t quotes = 0;
+        const auto scan_ms = measure_ms([&]() { quotes = static_cast<std::size_t>(std::count(document->begin(), document->end(), '"')); });
+        Json::Validation validation;
+        const auto validate_ms = best_of_ms(3, [&]() { validation = Json::validate(*document); });
+        bool parsed = false;
+        const auto parse_ms = best_of_ms(3, [&]() { parsed = Json::parse(*document).valid(); });
+
+        TEST_INFO << megabytes << " MB, validate: " << megabytes / validate_ms * 1000 << " MB/s, parse: "
+                  << megabytes / parse_ms * 1000 << " MB/s, counting quotes: " << megabytes / scan_ms * 1000 << " MB/s"
+                  << std::endl;
+        EXPECT_GT(quotes, 0u);
+        EXPECT_TRUE(validation);
+        EXPECT_TRUE(parsed);
+        EXPECT_LT(validate_ms * 3, parse_ms);
+    }
+}
+
+TEST(JsonBenchmark, string_parsing_throughput)
+{
+    std::string plain = "[";
+    std::string escaped = "[";
+    for (int i = 0; i < 100000; ++i) {
+        plain += R"("a description of the item that is long enough to be typical of text fields )" + std::to_string(i) + "\", ";
+        escaped += R"("a \"quoted\" description\nover two lines with é and 😀 )" + std::to_string(i) + "\", ";
+    }
+    plain += "\"\"]";
+    escaped += "\"\"]";
+
+    for (const auto* document : {&plain, &escaped}) {
+        const auto megabytes = static_cast<double>(document->size()) / (1024 * 1024);
+        std::optional<Json> json;
+        const auto parse_ms = measure_ms([&]() { json = Json::parse(*document); });
+        TEST_INFO << (document == &plain ? "Plain" : "Escaped") << " strings, " << megabytes << " MB: "
+                  << megabytes / parse_ms * 1000 << " MB/s" << std::endl;
+        ASSERT_TRUE(*json);
+        EXPECT_EQ(json->elements().size(), 100001u);
+    }
+}
@@ -217,6 +217,76 @@ TEST(Json, value_test)
     }
 }
 
+TEST(Json, number_types_and_ranges)
+{
+    const auto max_int = std::to_string(std::numeric_limits<int>::max());
+    const auto min_long_long = std::to_string(std::numeric_limits<long long>::min());
+    Json numbers("[0, -0, " + max_int + ", " + max_int + "0, " + min_long_long + ", 2.5E-3, -0.0, 4.9e-324]");
+    ASSERT_TRUE(numbers);
+
+    EXPECT_EQ(numbers.at(0), 0);
+    EXPECT_EQ(numbers.at(1), 0);
+    EXPECT_EQ(numbers.at(2), std::numeric_limits<int>::max());
+    EXPECT_FALSE(numbers.at(3).is<int>());
+    EXPECT_EQ(std::get<double>(numbers.at(5)), 2.5e-3);
+    EXPECT_TRUE(numbers.at(6).is<double>());
+    EXPECT_GT(std::get<double>(numbers.at(7)), 0.0);
+    if (numbers.at(4).is<long>()) {
+        EXPECT_EQ(std::get<long>(numbers.at(4)), std::numeric_limits<long long>::min());
+    } else {
+        EXPECT_EQ(std::get<long long>(numbers.at(4)), std::numeric_limits<long long>::min());
+    }
+
+    // Numbers out of range make the document invalid rather than throwing
+    EXPECT_FALSE(Json("[1e999]"));
+    EXPECT_FALSE(Json("[-1e-999]"));
+    EXPECT_FALSE(Json("[" + min_long_long + "0]"));
+
+    // Long numbers are converted too, whatever the standard library offers
+    const Json long_number("[1." + std::string(100, '0') + "1e2]");
+    ASSERT_TRUE(long_number);
+    EXPECT_EQ(std::get<double>(long_number.at(0)), 100.0);
+}
+
+TEST(Json, zero_copy_access)
+{
+    const Json json(sample_json);
+    ASSERT_TRUE(json);
+
+    const auto* value = json.find("phone_number[1].number");
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, "646 555-4567"s);
+    EXPECT_EQ(json.find("phone_number[99]"), nullptr);
+
+    const auto* phone_numbers = json.get_if<Json>("phone_number");
+    ASSERT_NE(phone_numbers, nullptr);
+    EXPECT_EQ(phone_numbers, &std::get<Json>(json.at("phone_number")));
+    EXPECT_EQ(json.get_if<std::string>("phone_number"), nullptr);
+    EXPECT_EQ(json.get_if<int>("first_name"), nullptr);
+
+    const auto first_name = json.get<std::string_view>("first_name");
+    ASSERT_TRUE(first_name);
+    EXPECT_EQ(*first_name, "John");
+    EXPECT_EQ(first_name->data(), json.get_if<std::string>("first_name")->data());
+    EXPECT_FALSE(json.get<std::string_view>("age"));
+
+    std::size_t count = 0;
+    for(const auto& [key, member] : json.members()) {
+        EXPECT_EQ(&member, &json.at(key));
+        ++count;
+    }
+    EXPECT_EQ(count, json.size());
+
+    count = 0;
+    for(const auto& element : phone_numbers->elements()) {
+        EXPECT_TRUE(element.is<Json>());
+        ++count;
+    }
+    EXPECT_EQ(count, phone_numbers->size());
+    EXPECT_THROW(json.elements(), bad_json_access);
+    EXPECT_THROW(phone_numbers->members(), bad_json_access);
+}
+
 TEST(Json,  property_access_and_modification)
 {
     Json json(sample_json);
@@ -315,3 +385,106 @@ TEST(Json, double_colon)
     Json missing("{\"hello\" null}");
     ASSERT_FALSE(missing);
 }
+
+TEST(Json, nested_values)
+{
+    Json json("{\"a\": {\"b\": [1, [2, {\"c\": [[], {}]}]]}, \"dup\": \"e\", \"dup\": \"f\"}");
+    ASSERT_TRUE(json);
+    EXPECT_EQ(json.size(), 2);
+    EXPECT_EQ(json.get<int>("a.b[1][0]"), 2);
+    EXPECT_EQ(json.get<Json>("a.b[1][1].c[0]"), Json("[]"));
+    EXPECT_EQ(json.get<Json>("a.b[1][1].c[1]"), Json("{}"));
+    // the last of the duplicate keys wins
+    EXPECT_EQ(json.get<std::string>("dup"), "f"s);
+    // keys are not interpreted as paths
+    Json odd_key("{\"a.b[0]\": {\"c\": 1}}");
+    ASSERT_TRUE(odd_key);
+    EXPECT_EQ(odd_key.get<int>("a\\.b\\[0\\].c"), 1);
+
+    Json exponent("[15e+3, 2E2]");
+    ASSERT_TRUE(exponent);
+    EXPECT_EQ(exponent.at(0), 15e3);
+    EXPECT_EQ(exponent.at(1), 2e2);
+}
+
+TEST(Json, nesting_depth_is_limited)
+{
+    const auto nested = [](std::size_t depth) {
+        return std::string(depth, '[') + std::string(depth, ']');
+    };
+    EXPECT_TRUE(Json(nested(1000)));
+    EXPECT_FALSE(Json(nested(100000)));
+}
+
+TEST(Json, validate_agrees_with_parse)
+{
+    const std::vector<std::string> documents{
+        sample_json, "{}", "[]", " [1, -2.5e+3, 0, -0.0, true, false, null, \"\"] ", "{\"a\":{\"b\":[{}, []]}}",
+        "{\"\\u00e9\\n\\\"\": \"x\\/y\\\\\"}", "[\"" + std::string(100, 'a') + "\\t" + std::string(40, 'b') + "\"]",
+        "", "   ", "1", "\"text\"", "[", "[1,]", "[01]", "[1.]", "[.5]", "[1e]", "[-]", "[tru]", "[nul]",
+        "{\"a\" 1}", "{\"a\":}", "{1:2}", "{\"a\":1,}", "[1 2]", "[1}", "{\"a\":1]", "[]]", "[] x",
+        "[\"\\x\"]", "[\"\\u12G4\"]", "[\"a\nb\"]", "[\"" + std::string(50, 'a'), "{\"a\":[{\"b\":[1,2,{\"c\":tru}]}]}",
+        std::string(1024, '[') + std::string(1024, ']'), std::string(1025, '[') + std::string(1025, ']'),
+        "[1e999]", "[-1e-999]", "[123456789012345678901234]", "{\"a\": -9223372036854775809}",
+        "[9223372036854775807, -9223372036854775808, 1e308, 4.9e-324]", "[999999999999999999, -99999999999999999]",
+        "[9999999999999999999]", "[-9999999999999999999]"
+    };
+    for (const auto& document : documents) {
+        EXPECT_EQ(Json::validate(document).valid, Json::parse(document).valid()) << document;
+    }
+}
+
+TEST(Json, validate_reports_the_offset)
+{
+    const auto valid = Json::validate(" {\"a\": [1, 2]} ");
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(valid.offset, 15u);
+
+    EXPECT_EQ(Json::validate("").offset, 0u);
+    EXPECT_EQ(Json::validate("  1").offset, 2u);
+    EXPECT_EQ(Json::validate("[1, 2,]").offset, 6u);
+    EXPECT_EQ(Json::validate("[1, 2").offset, 5u);
+    EXPECT_EQ(Json::validate("{\"a\": nul}").offset, 9u);
+    EXPECT_EQ(Json::validate("{\"a\": 1.e5}").offset, 8u);
+    EXPECT_EQ(Json::validate("[1, 1e999]").offset, 4u);
+    EXPECT_EQ(Json::validate("[\"abcdefghijklmnopqrstuvwxyz\\q\"]").offset, 29u);
+    EXPECT_EQ(Json::validate("[\"abcdefghijklmnopqrstuvwxyz\x01\"]").offset, 28u);
+    EXPECT_EQ(Json::validate("[\"abcdefghijklmnopqrstuvwxyz").offset, 28u);
+    EXPECT_EQ(Json::validate("{\"a\": 1}}").offset, 8u);
+    EXPECT_EQ(Json::validate("[true, fals]").offset, 11u);
+    EXPECT_EQ(Json::validate("{1: 2}").offset, 1u);
+    EXPECT_EQ(Json::validate("{\"a\" 1}").offset, 5u);
+    EXPECT_EQ(Json::validate("[\"\\u12x4\"]").offset, 6u);
+    EXPECT_EQ(Json::validate(std::string(1025, '[')).offset, 1024u);
+}
+
+TEST(Json, strings_are_decoded)
+{
+    const auto json = Json::parse(R"(["é€", "😀", "\ud83d", "\ude00x", "\ud83dA",
+                                      "a\"b\\c\/d\b\f\n\r\t", "\u0000"])");
+    ASSERT_TRUE(json);
+    EXPECT_EQ(json.at(0), "\xC3\xA9\xE2\x82\xAC"s);
+    EXPECT_EQ(json.at(1), "\xF0\x9F\x98\x80"s);
+    // Unpaired surrogates are replaced by U+FFFD
+    EXPECT_EQ(json.at(2), "\xEF\xBF\xBD"s);
+    EXPECT_EQ(json.at(3), "\xEF\xBF\xBDx"s);
+    EXPECT_EQ(json.at(4), "\xEF\xBF\xBD" "A"s);
+    EXPECT_EQ(json.at(5), "a\"b\\c/d\b\f\n\r\t"s);
+    EXPECT_EQ(json.at(6), "\0"s);
+}
+
+TEST(Json, long_strings)
+{
+    // Lengths around the 16 characters scanned at a time
+    for (std::size_t length = 0; length < 40; ++length) {
+        const std::string plain(length, 'x');
+        const auto json = Json::parse("[\"" + plain + "\", \"" + plain + "\\n" + plain + "\"]");
+        ASSERT_TRUE(json) << length;
+        EXPECT_EQ(json.at(0), plain);
+        EXPECT_EQ(json.at(1), plain + "\n" + plain);
+
+        EXPECT_FALSE(Json::parse("[\"" + plain + "\t" + plain + "\"]")) << length;
+        EXPECT_FALSE(Json::parse("[\"" + plain)) << length;
+        EXPECT_FALSE(Json::parse("[\"" + plain + "\\")) << length;
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/LazyJson.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(LazyJsonBenchmark, lazy_field_access)
+{
+    // Wide document, the fields of interest are at the end
+    std::string document = "{";
+    for (int i = 0; i < 20000; ++i)
+        document += "\"record" + std::to_string(i) + "\": " + nested_document(2, 3) + ", ";
+    document += "\"id\": 42, \"name\": \"last\", \"tags\": [\"a\", \"b\"]}";
+    const auto megabytes = static_cast<double>(document.size()) / (1024 * 1024);
+
+    std::optional<int> dom_id;
+    const auto dom_ms = best_of_ms(3, [&]() {
+        Json json(document);
+        dom_id = json.get<int>("id");
+    });
+
+    std::optional<int> lazy_id;
+    const auto lazy_ms = best_of_ms(3, [&]() {
+        LazyJson json(document);
+        lazy_id = json.get<int>("id");
+    });
+
+    const LazyJson json(document);
+    const auto access_ms = measure_ms([&]() {
+        for (int i = 0; i < 100; ++i)
+            ASSERT_TRUE(json.get<std::string>("tags[1]"));
+    });
+
+    ASSERT_EQ(dom_id, 42);
+    ASSERT_EQ(lazy_id, 42);
+    TEST_INFO << "Document of " << megabytes << " MB" << std::endl;
+    TEST_INFO << "DOM parse and access: " << dom_ms << " ms" << std::endl;
+    TEST_INFO << "Lazy load and access: " << lazy_ms << " ms" << std::endl;
+    TEST_INFO << "Lazy access of the last field: " << access_ms * 10 << " us" << std::endl;
+    EXPECT_LT(lazy_ms, dom_ms);
+}
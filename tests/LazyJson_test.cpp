@@ -0,0 +1,126 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/LazyJson.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace Core;
+
+namespace {
+const std::string document = "{\n"
+                             "  \"name\": \"John\",\n"
+                             "  \"age\": 25,\n"
+                             "  \"height\": 1.85,\n"
+                             "  \"address\": {\"city\": \"New York\", \"zip\": null, \"empty\": {}},\n"
+                             "  \"phones\": [{\"type\": \"home\"}, {\"type\": \"fax\"}, []],\n"
+                             "  \"active\": true,\n"
+                             "  \"active\": false\n"
+                             "}";
+}
+
+TEST(LazyJson, gets_values_on_the_path)
+{
+    const LazyJson json(document);
+    ASSERT_TRUE(json.valid());
+
+    EXPECT_EQ(json.get<std::string>("name"), "John");
+    EXPECT_EQ(json.get<int>("age"), 25);
+    EXPECT_EQ(json.get<double>("height"), 1.85);
+    EXPECT_EQ(json.get<std::string>("address.city"), "New York");
+    EXPECT_TRUE(json.get<Json::Null>("address.zip"));
+    EXPECT_EQ(json.get<std::string>("phones[1].type"), "fax");
+    EXPECT_FALSE(json.get("phones[3]"));
+    EXPECT_FALSE(json.get("address.country"));
+    EXPECT_EQ(json.get<int>("name", 7), 7);
+}
+
+TEST(LazyJson, matches_json)
+{
+    const LazyJson lazy(document);
+    const Json json(document);
+
+    // duplicated keys are not merged by the index
+    EXPECT_EQ(lazy.size(), json.size() + 1);
+    EXPECT_EQ(lazy.get<bool>("active"), json.get<bool>("active"));
+    EXPECT_EQ(lazy.get<Json>("address"), json.get<Json>("address"));
+    EXPECT_EQ(lazy.get<Json>("phones"), json.get<Json>("phones"));
+    EXPECT_EQ(lazy.root().get<Json>(), Json(document));
+}
+
+TEST(LazyJson, elements)
+{
+    const LazyJson json(document);
+
+    const auto phones = json.at("phones");
+    EXPECT_TRUE(phones.is_array());
+    EXPECT_EQ(phones.size(), 3u);
+    EXPECT_EQ(phones.at(0).at("type").raw(), "home");
+    EXPECT_EQ(phones.at(2).raw(), "[]");
+    EXPECT_EQ(json.at("address").at("empty").raw(), "{}");
+    EXPECT_EQ(json.at("address").raw(), "{\"city\": \"New York\", \"zip\": null, \"empty\": {}}");
+    EXPECT_TRUE(json.at("age").is_number());
+    EXPECT_TRUE(json.at("active").is_bool());
+
+    EXPECT_THROW(phones.at("type"), bad_json_access);
+    EXPECT_THROW(phones.at(3), std::out_of_range);
+    EXPECT_THROW(json.at("missing"), std::out_of_range);
+}
+
+TEST(LazyJson, validates_on_load)
+{
+    for (const std::string text : {"", "1", "{", "{\"a\": }", "[1, 2,]", "[\"\\x\"]", "[1] 2", "{\"a\": tru}"}) {
+        const LazyJson json(text);
+        EXPECT_FALSE(json.valid()) << text;
+        EXPECT_FALSE(json.get("a"));
+        EXPECT_THROW(json.root(), bad_json_access);
+    }
+
+    const auto depth = 1025;
+    EXPECT_FALSE(LazyJson(std::string(depth, '[') + std::string(depth, ']')).valid());
+}
+
+TEST(LazyJson, numbers_are_converted_on_access)
+{
+    const LazyJson json("[1, 99999999999999999999999]");
+
+    ASSERT_TRUE(json.valid());
+    EXPECT_EQ(json.get<int>("[0]"), 1);
+    EXPECT_FALSE(json.get("[1]"));
+    EXPECT_FALSE(json.root().value());
+}
+
+TEST(LazyJson, finds_escaped_keys)
+{
+    const LazyJson json(R"({"a\"b": 1, "été": 2, "tab\t": 3, "😀": 4})");
+
+    ASSERT_TRUE(json.valid());
+    EXPECT_EQ(json.at("a\"b").raw(), "1");
+    EXPECT_EQ(json.at("\xc3\xa9t\xc3\xa9").raw(), "2");
+    EXPECT_EQ(json.at("tab\t").raw(), "3");
+    EXPECT_EQ(json.at("\xf0\x9f\x98\x80").raw(), "4");
+    EXPECT_FALSE(json.root().find("a\""));
+    EXPECT_FALSE(json.root().find("a\"bc"));
+}
+
+TEST(LazyJson, finds_members_of_large_objects)
+{
+    std::string text = "{";
+    for (int i = 0; i < 100; ++i)
+        text += "\"key\\u005f" + std::to_string(i) + "\": [" + std::to_string(i) + "], ";
+    text += "\"key_7\": 700}";
+
+    const LazyJson lazy(text);
+    ASSERT_TRUE(lazy.valid());
+    for (int i = 0; i < 100; ++i) {
+        const auto expected = i == 7 ? 700 : i;
+        EXPECT_EQ(lazy.get<int>("key_" + std::to_string(i) + (i == 7 ? "" : "[0]")), expected);
+    }
+    EXPECT_FALSE(lazy.root().find("key_100"));
+    EXPECT_EQ(lazy.root().get<Json>(), Json(text));
+}
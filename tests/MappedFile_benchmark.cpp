@@ -0,0 +1,58 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/LazyJson.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include "JsonBenchmark.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+
+using namespace Core;
+using namespace JsonBenchmark;
+
+TEST(MappedFileBenchmark, mapped_load_against_reading)
+{
+    const auto path = std::filesystem::temp_directory_path() / "json_benchmark_load.json";
+    const auto document = nested_document(100, 10000);
+    std::ofstream(path, std::ios::binary) << document;
+
+    // What loading took before: copy the file into a string, then parse it
+    const auto read = [&path]() {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+
+    std::optional<Json> from_string;
+    std::optional<Json> from_mapping;
+    const auto read_parse_ms = measure_ms([&]() { from_string.emplace(read()); });
+    const auto load_ms = measure_ms([&]() { from_mapping.emplace(Json::load(path.string())); });
+
+    std::optional<LazyJson> lazy_from_string;
+    std::optional<LazyJson> lazy_from_mapping;
+    const auto heap_before = heap_usage();
+    const auto lazy_read_ms = measure_ms([&]() { lazy_from_string.emplace(read()); });
+    const auto heap_read = heap_usage();
+    const auto lazy_load_ms = measure_ms([&]() { lazy_from_mapping.emplace(LazyJson::load(path.string())); });
+    const auto heap_load = heap_usage();
+    std::filesystem::remove(path);
+
+    TEST_INFO << document.size() << " bytes, read and parse: " << read_parse_ms << " ms, load: " << load_ms
+              << " ms" << std::endl;
+    TEST_INFO << "Lazy, read and index: " << lazy_read_ms << " ms (" << (heap_read - heap_before) / 1024
+              << " KiB), load: " << lazy_load_ms << " ms (" << (heap_load - heap_read) / 1024 << " KiB)" << std::endl;
+    ASSERT_TRUE(from_mapping && from_mapping->valid());
+    EXPECT_EQ(*from_mapping, *from_string);
+    ASSERT_TRUE(lazy_from_mapping && lazy_from_mapping->valid());
+    EXPECT_EQ(lazy_from_mapping->get<std::string>("key[1]"), "abc");
+    // The mapped document does not hold a copy of the text
+    EXPECT_LE(heap_load - heap_read, heap_read - heap_before - document.size() / 2);
+}
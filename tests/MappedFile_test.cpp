@@ -0,0 +1,95 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <Json/Json.hpp>
+#include <Json/LazyJson.hpp>
+#include <FileManager/MappedFile.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+
+using namespace Core;
+
+namespace {
+namespace fs = std::filesystem;
+
+const std::string document = "{\"name\": \"John\", \"quote\": \"say \\\"hi\\\"\", \"list\": [1, 2.5, null]}";
+
+class MappedFileTest : public ::testing::Test {
+protected:
+    fs::path path = fs::temp_directory_path() / "mapped_file_test.json";
+    fs::path empty_path = fs::temp_directory_path() / "mapped_file_test_empty.json";
+    fs::path missing_path = fs::temp_directory_path() / "mapped_file_test_missing.json";
+
+    void SetUp() override {
+        std::ofstream(path, std::ios::binary) << document;
+        std::ofstream(empty_path, std::ios::binary);
+        fs::remove(missing_path);
+    }
+
+    void TearDown() override {
+        fs::remove(path);
+        fs::remove(empty_path);
+    }
+};
+}
+
+TEST_F(MappedFileTest, maps_the_content)
+{
+    MappedFile file(path.string());
+    ASSERT_TRUE(file);
+    EXPECT_EQ(file.view(), document);
+    EXPECT_EQ(file.size(), document.size());
+
+    MappedFile moved(std::move(file));
+    EXPECT_FALSE(file.valid());
+    EXPECT_EQ(moved.view(), document);
+
+    const MappedFile empty(empty_path.string());
+    EXPECT_TRUE(empty.valid());
+    EXPECT_TRUE(empty.view().empty());
+
+    EXPECT_FALSE(MappedFile(missing_path.string()));
+    EXPECT_FALSE(MappedFile(fs::temp_directory_path().string()));
+}
+
+TEST_F(MappedFileTest, json_load)
+{
+    const auto json = Json::load(path.string());
+    ASSERT_TRUE(json);
+    EXPECT_EQ(json, Json(document));
+
+    EXPECT_FALSE(Json::load(missing_path.string()));
+    EXPECT_FALSE(Json::load(empty_path.string()));
+}
+
+TEST_F(MappedFileTest, lazy_json_load_views_the_mapping)
+{
+    std::optional<LazyJson> copy;
+    std::string_view name;
+    {
+        const auto json = LazyJson::load(path.string());
+        ASSERT_TRUE(json);
+        EXPECT_EQ(json.get<std::string>("quote"), "say \"hi\"");
+        EXPECT_FALSE(json.at("quote").view());
+        EXPECT_FALSE(json.at("list").view());
+
+        name = *json.at("name").view();
+        copy.emplace(json);
+    }
+
+    // The copy keeps the file mapped
+    EXPECT_EQ(name, "John");
+    EXPECT_EQ(copy->get<double>("list[1]"), 2.5);
+    EXPECT_EQ(copy->at("name").view(), name);
+
+    EXPECT_FALSE(LazyJson::load(missing_path.string()));
+    EXPECT_FALSE(LazyJson::load(empty_path.string()));
+    EXPECT_EQ(LazyJson(document).at("name").view(), "John");
+}
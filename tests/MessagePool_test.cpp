@@ -0,0 +1,91 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include <MessageQueue/MessagePool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+namespace {
+struct Payload {
+    int id = 0;
+    std::vector<char> buffer;
+};
+}
+
+TEST(MessagePool, messages_are_recycled)
+{
+    MessagePool<Payload> pool(4);
+    EXPECT_EQ(pool.capacity(), 0u);
+
+    const Payload* address = nullptr;
+    {
+        auto message = pool.acquire();
+        EXPECT_EQ(pool.capacity(), 4u);
+        EXPECT_EQ(pool.available(), 3u);
+        message->buffer.assign(1024, 'x');
+        address = message.get();
+    }
+    EXPECT_EQ(pool.available(), 4u);
+
+    auto message = pool.acquire();
+    EXPECT_EQ(message.get(), address);
+    // the buffer is not released, it can be refilled without allocation
+    EXPECT_GE(message->buffer.capacity(), 1024u);
+}
+
+TEST(MessagePool, grows_by_slabs)
+{
+    MessagePool<Payload> pool(2, 3);
+    EXPECT_EQ(pool.capacity(), 3u);
+
+    std::vector<MessagePool<Payload>::Handle> messages;
+    for (int i = 0; i < 4; ++i)
+        messages.push_back(pool.acquire());
+    EXPECT_EQ(pool.capacity(), 5u);
+    EXPECT_EQ(pool.available(), 1u);
+
+    pool.reserve(10);
+    EXPECT_EQ(pool.capacity(), 10u);
+    messages.clear();
+    EXPECT_EQ(pool.available(), 10u);
+}
+
+TEST(MessagePool, through_message_queue)
+{
+    constexpr int message_count = 10000;
+
+    MessagePool<Payload> pool(16, 16);
+    PooledMessageQueue<Payload> queue;
+    queue.reserve(16);
+
+    std::thread producer([&pool, &queue]() {
+        for (int i = 0; i < message_count; ++i) {
+            auto message = pool.acquire();
+            message->id = i;
+            message->buffer.resize(64);
+            queue.push(std::move(message));
+            // keep the number of messages in flight bounded
+            while (pool.available() == 0)
+                std::this_thread::yield();
+        }
+    });
+
+    long long sum = 0;
+    for (int i = 0; i < message_count; ++i) {
+        queue.wait_for_message();
+        auto message = queue.take();
+        sum += message->id;
+    }
+    producer.join();
+
+    EXPECT_EQ(sum, static_cast<long long>(message_count) * (message_count - 1) / 2);
+    EXPECT_EQ(pool.capacity(), 16u);
+    EXPECT_EQ(pool.available(), 16u);
+}
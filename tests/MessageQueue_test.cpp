@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <thread>
 #include <chrono>
 
@@ -83,3 +84,122 @@ TEST(MessageQueue, messages_can_be_waited_for)
     thread_one.join();
     thread_two.join();
 }
+
+TEST(MessageQueue, scheduled_messages_are_hidden_until_due)
+{
+    using namespace std::chrono_literals;
+
+    MessageQueue<std::string> simple_queue;
+    simple_queue.push_after(200ms, "later");
+    ASSERT_TRUE(simple_queue.empty());
+
+    simple_queue.push("now");
+    ASSERT_FALSE(simple_queue.empty());
+    ASSERT_EQ(simple_queue.take(), "now");
+    ASSERT_TRUE(simple_queue.empty());
+
+    std::this_thread::sleep_for(250ms);
+    ASSERT_FALSE(simple_queue.empty());
+    ASSERT_EQ(simple_queue.take(), "later");
+    ASSERT_TRUE(simple_queue.empty());
+}
+
+TEST(MessageQueue, scheduled_messages_keep_priority)
+{
+    using namespace std::chrono_literals;
+
+    MessageQueue<std::string> simple_queue;
+    const auto due = MessageQueue<std::string>::Clock::now() + 50ms;
+    simple_queue.push_at(due, MessagePriority::Low, "!");
+    simple_queue.push_at(due, MessagePriority::High, "Hello");
+    simple_queue.push_at(due, " world");
+
+    simple_queue.wait_for_message();
+    std::string result;
+    while(!simple_queue.empty())
+    {
+        result += simple_queue.take();
+    }
+    ASSERT_EQ(result, "Hello world!");
+}
+
+TEST(MessageQueue, waiting_wakes_up_when_scheduled_message_is_due)
+{
+    using namespace std::chrono_literals;
+
+    MessageQueue<int> simple_queue;
+    for (int i = 0; i < 100000; ++i)
+        simple_queue.push_after(1h + std::chrono::milliseconds(i), i);
+
+    using Clock = MessageQueue<int>::Clock;
+    std::atomic<Clock::rep> due_ticks{0};
+    std::thread producer([&simple_queue, &due_ticks]() {
+        std::this_thread::sleep_for(100ms);
+        // earlier than anything pending, the waiting consumer has to adjust
+        const auto due = Clock::now() + 200ms;
+        due_ticks = due.time_since_epoch().count();
+        simple_queue.push_at(due, -1);
+    });
+
+    simple_queue.wait_for_message();
+    const auto woke_at = Clock::now();
+    producer.join();
+
+    const Clock::time_point due{Clock::duration{due_ticks.load()}};
+    auto late_ms = std::chrono::duration_cast<std::chrono::milliseconds>(woke_at - due).count();
+
+    TEST_INFO << "Woke up " << late_ms << " ms after the deadline" << std::endl;
+    ASSERT_GE(woke_at, due);
+    ASSERT_LT(woke_at, due + 1s);
+    ASSERT_EQ(simple_queue.take(), -1);
+    ASSERT_TRUE(simple_queue.empty());
+}
+
+TEST(MessageQueue, metrics_are_recorded)
+{
+    using namespace std::chrono_literals;
+
+    static_assert(sizeof(MessageQueue<int>) < sizeof(MessageQueue<int, MessageQueueMetrics>),
+                  "uninstrumented queues must not carry the metrics");
+
+    MessageQueue<std::string, MessageQueueMetrics> simple_queue;
+    simple_queue.push("one");
+    simple_queue.push("two");
+    simple_queue.push_after(10ms, "three");
+
+    auto snapshot = simple_queue.metrics().snapshot();
+    EXPECT_EQ(snapshot.depth, 2u);
+    EXPECT_EQ(snapshot.peak_depth, 2u);
+    EXPECT_EQ(snapshot.enqueued, 2u);
+    EXPECT_EQ(snapshot.dequeued, 0u);
+
+    // The scheduled message is counted once due, even before a consumer looks at the queue
+    std::this_thread::sleep_for(20ms);
+    snapshot = simple_queue.metrics().snapshot();
+    EXPECT_EQ(snapshot.depth, 3u);
+    EXPECT_EQ(snapshot.peak_depth, 3u);
+    EXPECT_EQ(snapshot.enqueued, 3u);
+
+    while (!simple_queue.empty()) {
+        simple_queue.wait_for_message();
+        simple_queue.take();
+    }
+    snapshot = simple_queue.metrics().snapshot();
+    EXPECT_EQ(snapshot.depth, 0u);
+    EXPECT_EQ(snapshot.peak_depth, 3u);
+    EXPECT_EQ(snapshot.enqueued, 3u);
+    EXPECT_EQ(snapshot.dequeued, 3u);
+    // Two messages waited 20ms, the scheduled one 10ms from its due time
+    EXPECT_GE(snapshot.total_time_in_queue, 50ms);
+    EXPECT_EQ(snapshot.waits, 3u);
+
+    // Each spent at least 8192us in the queue, bucket 14 and above
+    std::uint64_t histogram_total = 0;
+    for (std::size_t bucket = 0; bucket < snapshot.time_in_queue_histogram.size(); ++bucket) {
+        if (bucket < 14) {
+            EXPECT_EQ(snapshot.time_in_queue_histogram[bucket], 0u) << bucket;
+        }
+        histogram_total += snapshot.time_in_queue_histogram[bucket];
+    }
+    EXPECT_EQ(histogram_total, 3u);
+}
@@ -0,0 +1,144 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+// Selector is built on epoll
+#if defined(__linux__)
+
+#include <MessageQueue/SelectableMessageQueue.hpp>
+#include <MessageQueue/Selector.hpp>
+#include <Utils/TestUtil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include <unistd.h>
+
+using namespace Core;
+
+namespace {
+bool contains(const std::vector<ISelectable*>& sources, const ISelectable& source) {
+    return std::find(sources.begin(), sources.end(), &source) != sources.end();
+}
+}
+
+TEST(Selector, reports_queues_with_messages)
+{
+    using namespace std::chrono_literals;
+
+    static_assert(!std::is_polymorphic_v<MessageQueue<int>>,
+                  "plain queues must not pay for selectability");
+    static_assert(sizeof(MessageQueue<int>) < sizeof(SelectableMessageQueue<int>),
+                  "plain queues must not carry a readiness descriptor");
+
+    SelectableMessageQueue<std::string> first;
+    SelectableMessageQueue<int> second;
+    SelectableCoalescingMessageQueue<int, int> third;
+    first.push("already there");
+
+    Selector selector;
+    selector.add(first);
+    selector.add(second);
+    selector.add(third);
+
+    auto result = selector.wait();
+    ASSERT_EQ(result.sources.size(), 1u);
+    EXPECT_TRUE(contains(result.sources, first));
+    EXPECT_EQ(first.take(), "already there");
+
+    EXPECT_TRUE(selector.wait_for(10ms).empty());
+
+    second.push(42);
+    third.push(1, 2);
+    result = selector.wait_for(1s);
+    EXPECT_EQ(result.sources.size(), 2u);
+    EXPECT_TRUE(contains(result.sources, second));
+    EXPECT_TRUE(contains(result.sources, third));
+    EXPECT_EQ(second.take(), 42);
+    EXPECT_EQ(third.take().second, 2);
+
+    EXPECT_TRUE(selector.wait_for(10ms).empty());
+}
+
+TEST(Selector, wakes_up_on_push_from_other_thread)
+{
+    using namespace std::chrono_literals;
+
+    SelectableMessageQueue<std::string> queue;
+    Selector selector;
+    selector.add(queue);
+
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(100ms);
+        queue.push("delayed msg");
+    });
+
+    auto time_at_start = std::chrono::steady_clock::now();
+    auto result = selector.wait();
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - time_at_start).count();
+
+    TEST_INFO << "Elapsed time: " << elapsed_ms << " ms" << std::endl;
+    EXPECT_GE(elapsed_ms, 100);
+    ASSERT_TRUE(contains(result.sources, queue));
+    EXPECT_EQ(queue.take(), "delayed msg");
+    producer.join();
+}
+
+TEST(Selector, wakes_up_when_scheduled_message_is_due)
+{
+    using namespace std::chrono_literals;
+
+    SelectableMessageQueue<int> queue;
+    Selector selector;
+    selector.add(queue);
+    queue.push_after(1h, 1);
+
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(50ms);
+        queue.push_after(100ms, 2);
+    });
+
+    auto time_at_start = std::chrono::steady_clock::now();
+    auto result = selector.wait();
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - time_at_start).count();
+
+    TEST_INFO << "Elapsed time: " << elapsed_ms << " ms" << std::endl;
+    EXPECT_GE(elapsed_ms, 150);
+    ASSERT_TRUE(contains(result.sources, queue));
+    EXPECT_EQ(queue.take(), 2);
+    EXPECT_TRUE(queue.empty());
+    producer.join();
+}
+
+TEST(Selector, plain_file_descriptors)
+{
+    using namespace std::chrono_literals;
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    SelectableMessageQueue<int> queue;
+    Selector selector;
+    selector.add(queue);
+    selector.add(fds[0]);
+
+    EXPECT_TRUE(selector.wait_for(10ms).empty());
+
+    ASSERT_EQ(::write(fds[1], "x", 1), 1);
+    auto result = selector.wait();
+    EXPECT_TRUE(result.sources.empty());
+    ASSERT_EQ(result.fds.size(), 1u);
+    EXPECT_EQ(result.fds.front(), fds[0]);
+
+    selector.remove(fds[0]);
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+#endif